@@ -1,9 +1,56 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <deque>
+#include <algorithm>
 #include <unordered_map>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <functional>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
+// Stream compaction: keeps data[i] where keep[i] is 1, returns the new length.
+// Writes never pass the read cursor, so it is safe to run in place.
+int compactInts(int *data, const uint8_t *keep, int n) {
+    int out = 0, i = 0;
+#ifdef __AVX2__
+    // lanes[m] lists the set bit positions of m, padded with zeros
+    static const auto lanes = [] {
+        vector<int32_t> table(256 * 8, 0);
+        for (int m = 0; m < 256; ++m) {
+            int k = 0;
+            for (int b = 0; b < 8; ++b) {
+                if (m & (1 << b)) table[m * 8 + k++] = b;
+            }
+        }
+        return table;
+    }();
+    for (; i + 8 <= n; i += 8) {
+        __m128i flags = _mm_loadl_epi64((const __m128i *)(keep + i));
+        int m = _mm_movemask_epi8(_mm_cmpgt_epi8(flags, _mm_setzero_si128())) & 0xff;
+        __m256i values = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i perm = _mm256_loadu_si256((const __m256i *)&lanes[m * 8]);
+        _mm256_storeu_si256((__m256i *)(data + out), _mm256_permutevar8x32_epi32(values, perm));
+        out += __builtin_popcount(m);
+    }
+#endif
+    for (; i < n; ++i) {
+        data[out] = data[i];
+        out += keep[i];
+    }
+    return out;
+}
+
 // Static Array Implementation
 class StaticArray {
 private:
@@ -36,6 +83,32 @@ public:
         }
     }
 
+    // Removes every listed index (duplicates allowed) in one linear pass
+    void removeMany(const vector<int> &indices) {
+        vector<uint8_t> keep(count, 1);
+        for (int index : indices) {
+            if (index >= 0 && index < count) {
+                keep[index] = 0;
+            } else {
+                cout << "Invalid index\n";
+            }
+        }
+        count = compactInts(array, keep.data(), count);
+    }
+
+    // Removes every element matching pred, returns how many were removed
+    template <typename Predicate>
+    int removeIf(Predicate pred) {
+        int out = 0;
+        for (int i = 0; i < count; ++i) {
+            array[out] = array[i];
+            out += !pred(array[i]);
+        }
+        int removed = count - out;
+        count = out;
+        return removed;
+    }
+
     void traverse() {
         for (int i = 0; i < count; ++i) {
             cout << array[i] << " ";
@@ -48,35 +121,532 @@ public:
     }
 };
 
+// Tiered Array Implementation
+// Elements live in fixed-size circular blocks; every block except the last is
+// full, so index -> (block, offset) is a shift and a mask. Insert/remove shift
+// inside one block and then carry a single element across each later block,
+// giving O(sqrt n) updates with O(1) indexed access.
+class TieredArray {
+private:
+    struct Block {
+        vector<int> data;
+        size_t head, count;
+
+        Block(size_t capacity) : data(capacity), head(0), count(0) {}
+
+        int &at(size_t offset, size_t mask) {
+            return data[(head + offset) & mask];
+        }
+
+        void pushFront(int value, size_t mask) {
+            head = (head - 1) & mask;
+            data[head] = value;
+            count++;
+        }
+
+        void pushBack(int value, size_t mask) {
+            data[(head + count) & mask] = value;
+            count++;
+        }
+
+        int popFront(size_t mask) {
+            int value = data[head];
+            head = (head + 1) & mask;
+            count--;
+            return value;
+        }
+
+        int popBack(size_t mask) {
+            count--;
+            return data[(head + count) & mask];
+        }
+
+        void insertAt(size_t offset, int value, size_t mask) {
+            for (size_t i = count; i > offset; --i) {
+                at(i, mask) = at(i - 1, mask);
+            }
+            at(offset, mask) = value;
+            count++;
+        }
+
+        int removeAt(size_t offset, size_t mask) {
+            int value = at(offset, mask);
+            for (size_t i = offset; i + 1 < count; ++i) {
+                at(i, mask) = at(i + 1, mask);
+            }
+            count--;
+            return value;
+        }
+    };
+
+    static const size_t MIN_SHIFT = 4;
+
+    vector<Block> blocks;
+    size_t shift, mask, count;
+
+    // Re-split the contents so the block size tracks sqrt(count)
+    void rebuild(size_t newShift) {
+        vector<int> values = toVector();
+        shift = newShift;
+        mask = (size_t(1) << shift) - 1;
+        blocks.clear();
+        count = 0;
+        for (int value : values) {
+            insert(count, value);
+        }
+    }
+
+public:
+    TieredArray() : shift(MIN_SHIFT), mask((size_t(1) << MIN_SHIFT) - 1), count(0) {}
+
+    size_t size() const {
+        return count;
+    }
+
+    int &operator[](size_t index) {
+        return blocks[index >> shift].at(index & mask, mask);
+    }
+
+    void insert(size_t index, int value) {
+        if (count == blocks.size() << shift) {
+            if (blocks.size() > (size_t(2) << shift)) {
+                rebuild(shift + 1);
+            }
+            if (count == blocks.size() << shift) {
+                blocks.emplace_back(mask + 1);
+            }
+        }
+        size_t k = index >> shift;
+        for (size_t j = blocks.size() - 1; j > k; --j) {
+            blocks[j].pushFront(blocks[j - 1].popBack(mask), mask);
+        }
+        blocks[k].insertAt(index & mask, value, mask);
+        count++;
+    }
+
+    int remove(size_t index) {
+        size_t k = index >> shift;
+        int value = blocks[k].removeAt(index & mask, mask);
+        for (size_t j = k + 1; j < blocks.size(); ++j) {
+            blocks[j - 1].pushBack(blocks[j].popFront(mask), mask);
+        }
+        if (blocks.back().count == 0) {
+            blocks.pop_back();
+        }
+        count--;
+        if (shift > MIN_SHIFT && blocks.size() < (size_t(1) << shift) / 8) {
+            rebuild(shift - 1);
+        }
+        return value;
+    }
+
+    vector<int> toVector() {
+        vector<int> values;
+        values.reserve(count);
+        for (Block &block : blocks) {
+            for (size_t i = 0; i < block.count; ++i) {
+                values.push_back(block.at(i, mask));
+            }
+        }
+        return values;
+    }
+};
+
 // Dynamic Array Implementation
 class DynamicArray {
+public:
+    enum Storage { VECTOR, TIERED };
+
 private:
+    Storage storage;
     vector<int> array;
+    TieredArray tiered;
 
 public:
+    DynamicArray(Storage storage = VECTOR) : storage(storage) {}
+
+    int size() {
+        return storage == TIERED ? tiered.size() : array.size();
+    }
+
+    int get(int index) {
+        return storage == TIERED ? tiered[index] : array[index];
+    }
+
     void insert(int value) {
-        array.push_back(value);
+        insertAt(size(), value);
+    }
+
+    void insertAt(int index, int value) {
+        if (index < 0 || index > size()) {
+            cout << "Invalid index\n";
+        } else if (storage == TIERED) {
+            tiered.insert(index, value);
+        } else {
+            array.insert(array.begin() + index, value);
+        }
     }
 
     void remove(int index) {
-        if (index >= 0 && index < array.size()) {
-            array.erase(array.begin() + index);
+        if (index >= 0 && index < size()) {
+            if (storage == TIERED) {
+                tiered.remove(index);
+            } else {
+                array.erase(array.begin() + index);
+            }
         } else {
             cout << "Invalid index\n";
         }
     }
 
     void traverse() {
-        for (int val : array) {
-            cout << val << " ";
+        for (int i = 0; i < size(); ++i) {
+            cout << get(i) << " ";
         }
         cout << endl;
     }
 };
 
+// Random-position deletes on both DynamicArray backends
+void benchmarkDynamicArray(int elements, int deletes) {
+    const char *names[] = {"vector", "tiered"};
+    DynamicArray::Storage modes[] = {DynamicArray::VECTOR, DynamicArray::TIERED};
+    for (int m = 0; m < 2; ++m) {
+        DynamicArray arr(modes[m]);
+        for (int i = 0; i < elements; ++i) {
+            arr.insert(i);
+        }
+        mt19937 rng(42);
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < deletes; ++i) {
+            arr.remove(rng() % arr.size());
+        }
+        auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+        cout << names[m] << ": " << deletes << " deletes from " << elements
+             << " elements in " << elapsed.count() << " us\n";
+    }
+}
+
+// String Rope (deferred concatenation)
+// Appends record a view per piece instead of copying bytes. Borrowed pieces
+// must outlive the rope; moved-in strings are kept in a deque so views into
+// them stay valid. The flat string is built lazily and only extended with
+// pieces appended since the last materialization.
+class StringRope {
+private:
+    vector<string_view> pieces;
+    vector<size_t> offsets; // offsets[i] = start of pieces[i]
+    deque<string> owned;
+    size_t length;
+    mutable string flat;
+    mutable size_t flatPieces;
+
+public:
+    StringRope() : length(0), flatPieces(0) {}
+
+    // A copy's views would still point into the source's owned strings;
+    // moving keeps them valid because the deque hands over its storage
+    StringRope(const StringRope &) = delete;
+    StringRope &operator=(const StringRope &) = delete;
+    StringRope(StringRope &&) = default;
+    StringRope &operator=(StringRope &&) = default;
+
+    StringRope &append(string_view piece) {
+        if (!piece.empty()) {
+            offsets.push_back(length);
+            pieces.push_back(piece);
+            length += piece.size();
+        }
+        return *this;
+    }
+
+    StringRope &append(string &&piece) {
+        owned.push_back(move(piece));
+        return append(string_view(owned.back()));
+    }
+
+    StringRope &append(const char *piece) {
+        return append(string_view(piece));
+    }
+
+    StringRope &append(const StringRope &other) {
+        size_t n = other.pieces.size(); // other may be *this
+        for (size_t i = 0; i < n; ++i) {
+            append(other.pieces[i]);
+        }
+        return *this;
+    }
+
+    // Takes over other's owned strings. Strings short enough to be stored
+    // inline change address when moved, so views into them are re-pointed.
+    StringRope &append(StringRope &&other) {
+        if (&other == this) return append(static_cast<const StringRope &>(other));
+        struct Moved {
+            const char *oldBegin, *oldEnd, *newBegin;
+        };
+        vector<Moved> moved;
+        for (string &text : other.owned) {
+            const char *oldBegin = text.data();
+            owned.push_back(move(text));
+            if (!owned.back().empty()) {
+                moved.push_back({oldBegin, oldBegin + owned.back().size(), owned.back().data()});
+            }
+        }
+        sort(moved.begin(), moved.end(), [](const Moved &a, const Moved &b) { return a.oldBegin < b.oldBegin; });
+        for (string_view piece : other.pieces) {
+            auto it = upper_bound(moved.begin(), moved.end(), piece.data(),
+                                  [](const char *p, const Moved &m) { return p < m.oldBegin; });
+            if (it != moved.begin() && piece.data() < (--it)->oldEnd) {
+                piece = string_view(it->newBegin + (piece.data() - it->oldBegin), piece.size());
+            }
+            append(piece);
+        }
+        other.pieces.clear();
+        other.offsets.clear();
+        other.owned.clear();
+        other.length = 0;
+        other.flat.clear();
+        other.flatPieces = 0;
+        return *this;
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+    // View of [start, end); copy-free when the range lies inside one piece,
+    // otherwise served from the materialized string (valid until next append)
+    string_view slice(size_t start, size_t end) const {
+        if (start >= end || start >= length) return string_view();
+        end = min(end, length);
+        size_t k = upper_bound(offsets.begin(), offsets.end(), start) - offsets.begin() - 1;
+        if (end <= offsets[k] + pieces[k].size()) {
+            return pieces[k].substr(start - offsets[k], end - start);
+        }
+        return string_view(str()).substr(start, end - start);
+    }
+
+    const string &str() const {
+        if (flatPieces < pieces.size()) {
+            flat.reserve(length);
+            for (; flatPieces < pieces.size(); ++flatPieces) {
+                flat.append(pieces[flatPieces]);
+            }
+        }
+        return flat;
+    }
+};
+
+// Equality for raw byte ranges: length check first, then 32-byte AVX2 blocks
+// (or 8-byte words) with a byte tail
+bool equalBytes(const char *a, const char *b, size_t n) {
+    size_t i = 0;
+#ifdef __AVX2__
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) != -1) return false;
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        if (x != y) return false;
+    }
+    for (; i < n; ++i) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// Interned String Handle
+// One pointer wide; two handles from the same pool are equal iff the
+// strings are equal, so comparison is a single pointer compare.
+class InternedString {
+public:
+    struct Entry {
+        string text;
+        size_t hash;
+    };
+
+private:
+    const Entry *entry;
+
+public:
+    InternedString(const Entry *entry = nullptr) : entry(entry) {}
+
+    const string &str() const {
+        return entry->text;
+    }
+
+    // std::hash<string_view> of the text, computed once when interned
+    size_t hash() const {
+        return entry->hash;
+    }
+
+    bool operator==(const InternedString &other) const {
+        return entry == other.entry;
+    }
+
+    bool operator!=(const InternedString &other) const {
+        return entry != other.entry;
+    }
+};
+
+// Hashing a handle returns the precomputed hash, so handles are cheap keys
+namespace std {
+template <>
+struct hash<InternedString> {
+    size_t operator()(const InternedString &s) const {
+        return s.hash();
+    }
+};
+} // namespace std
+
+// String Interning Pool
+// Strings are hashed once and routed to one of SHARDS independent tables.
+// The shard tables are keyed by (hash, text) and reuse that hash, so
+// neither lookups nor rehashing hash the text again. Lookups take only
+// that shard's shared lock, and the exclusive lock is needed only when a
+// new string is inserted. Entries live in a deque so handles stay valid
+// for the pool's lifetime.
+class StringPool {
+private:
+    static const size_t SHARDS = 16;
+
+    struct Key {
+        size_t hash;
+        string_view text;
+
+        bool operator==(const Key &other) const {
+            return hash == other.hash && text == other.text;
+        }
+    };
+
+    // The low bits already picked the shard, so drop them
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return key.hash / SHARDS;
+        }
+    };
+
+    struct Shard {
+        mutable shared_mutex lock;
+        unordered_map<Key, const InternedString::Entry *, KeyHash> index;
+        deque<InternedString::Entry> entries;
+    };
+
+    Shard shards[SHARDS];
+
+public:
+    InternedString intern(string_view s) {
+        size_t hash = std::hash<string_view>()(s);
+        Shard &shard = shards[hash % SHARDS];
+        {
+            shared_lock<shared_mutex> reader(shard.lock);
+            auto it = shard.index.find(Key{hash, s});
+            if (it != shard.index.end()) return InternedString(it->second);
+        }
+        unique_lock<shared_mutex> writer(shard.lock);
+        auto it = shard.index.find(Key{hash, s});
+        if (it != shard.index.end()) return InternedString(it->second);
+        shard.entries.push_back({string(s), hash});
+        const InternedString::Entry *entry = &shard.entries.back();
+        shard.index.emplace(Key{hash, string_view(entry->text)}, entry);
+        return InternedString(entry);
+    }
+
+    // Returns an empty handle (never equal to an interned one) if absent
+    InternedString find(string_view s) const {
+        size_t hash = std::hash<string_view>()(s);
+        const Shard &shard = shards[hash % SHARDS];
+        shared_lock<shared_mutex> reader(shard.lock);
+        auto it = shard.index.find(Key{hash, s});
+        return it != shard.index.end() ? InternedString(it->second) : InternedString();
+    }
+
+    size_t size() const {
+        size_t total = 0;
+        for (const Shard &shard : shards) {
+            shared_lock<shared_mutex> reader(shard.lock);
+            total += shard.entries.size();
+        }
+        return total;
+    }
+};
+
 // String Operations
 class StringOperations {
+private:
+    // Counts bytes into four interleaved sub-histograms so consecutive equal
+    // bytes do not serialize on the same counter, reading 8 bytes per load.
+    static void histogramRange(const unsigned char *data, size_t n, array<uint64_t, 256> &bins) {
+        const size_t FLUSH = size_t(1) << 30; // keeps uint32_t counters from overflowing
+        while (n > 0) {
+            size_t len = n < FLUSH ? n : FLUSH;
+            vector<uint32_t> sub(4 * 256, 0);
+            size_t i = 0;
+            for (; i + 8 <= len; i += 8) {
+                uint64_t word;
+                memcpy(&word, data + i, 8);
+                sub[0 * 256 + (word & 0xff)]++;
+                sub[1 * 256 + ((word >> 8) & 0xff)]++;
+                sub[2 * 256 + ((word >> 16) & 0xff)]++;
+                sub[3 * 256 + ((word >> 24) & 0xff)]++;
+                sub[0 * 256 + ((word >> 32) & 0xff)]++;
+                sub[1 * 256 + ((word >> 40) & 0xff)]++;
+                sub[2 * 256 + ((word >> 48) & 0xff)]++;
+                sub[3 * 256 + (word >> 56)]++;
+            }
+            for (; i < len; ++i) {
+                sub[data[i]]++;
+            }
+            for (int b = 0; b < 256; ++b) {
+                bins[b] += (uint64_t)sub[b] + sub[256 + b] + sub[512 + b] + sub[768 + b];
+            }
+            data += len;
+            n -= len;
+        }
+    }
+
 public:
+    static const size_t PARALLEL_HISTOGRAM_THRESHOLD = size_t(1) << 22;
+
+    // Dense 256-bin byte histogram; inputs above the threshold are split
+    // across hardware threads and the per-thread bins summed at the end.
+    static array<uint64_t, 256> byteHistogram(const char *data, size_t n) {
+        array<uint64_t, 256> bins{};
+        const unsigned char *bytes = (const unsigned char *)data;
+        size_t threads = thread::hardware_concurrency();
+        if (n < PARALLEL_HISTOGRAM_THRESHOLD || threads < 2) {
+            histogramRange(bytes, n, bins);
+            return bins;
+        }
+        vector<array<uint64_t, 256>> partial(threads, array<uint64_t, 256>{});
+        vector<thread> workers;
+        size_t chunk = (n + threads - 1) / threads;
+        for (size_t t = 0; t < threads; ++t) {
+            size_t begin = t * chunk;
+            if (begin >= n) break;
+            size_t len = min(chunk, n - begin);
+            workers.emplace_back(histogramRange, bytes + begin, len, ref(partial[t]));
+        }
+        for (thread &worker : workers) {
+            worker.join();
+        }
+        for (auto &part : partial) {
+            for (int b = 0; b < 256; ++b) {
+                bins[b] += part[b];
+            }
+        }
+        return bins;
+    }
+
+    static array<uint64_t, 256> byteHistogram(const string &s) {
+        return byteHistogram(s.data(), s.size());
+    }
+
     static string concatenate(const string &str1, const string &str2) {
         return str1 + str2;
     }
@@ -85,14 +655,25 @@ public:
         return s.substr(start, end - start);
     }
 
+    static string_view substringView(string_view s, int start, int end) {
+        return s.substr(start, end - start);
+    }
+
     static bool compare(const string &str1, const string &str2) {
+        return str1.size() == str2.size() && equalBytes(str1.data(), str2.data(), str1.size());
+    }
+
+    static bool compare(const InternedString &str1, const InternedString &str2) {
         return str1 == str2;
     }
 
     static unordered_map<char, int> characterFrequency(const string &s) {
+        array<uint64_t, 256> bins = byteHistogram(s);
         unordered_map<char, int> frequency;
-        for (char c : s) {
-            frequency[c]++;
+        for (int b = 0; b < 256; ++b) {
+            if (bins[b]) {
+                frequency[(char)b] = bins[b];
+            }
         }
         return frequency;
     }
@@ -112,6 +693,17 @@ int main() {
     cout << "After Deletion: ";
     sArray.traverse();
 
+    StaticArray bulkArray(10);
+    for (int i = 0; i < 10; ++i) {
+        bulkArray.insert(i);
+    }
+    bulkArray.removeMany({1, 4, 4, 7});
+    cout << "After Bulk Deletion: ";
+    bulkArray.traverse();
+    bulkArray.removeIf([](int value) { return value % 3 == 0; });
+    cout << "After removeIf(multiple of 3): ";
+    bulkArray.traverse();
+
     // Dynamic Array Example
     cout << "\nDynamic Array Example:\n";
     DynamicArray dArray;
@@ -123,13 +715,50 @@ int main() {
     cout << "After Deletion: ";
     dArray.traverse();
 
+    DynamicArray tArray(DynamicArray::TIERED);
+    for (int i = 1; i <= 5; ++i) {
+        tArray.insert(i * 10);
+    }
+    tArray.insertAt(2, 25);
+    tArray.remove(0);
+    cout << "Tiered Array Traversal: ";
+    tArray.traverse();
+
+    cout << "\nDynamic Array Benchmark:\n";
+    benchmarkDynamicArray(1000000, 2000);
+
     // String Operations Example
     cout << "\nString Operations Example:\n";
     string str1 = "hello", str2 = "world";
     cout << "Concatenation: " << StringOperations::concatenate(str1, str2) << endl;
     cout << "Substring: " << StringOperations::substring(str1, 1, 4) << endl;
+    StringRope rope;
+    rope.append(str1).append(string(", ")).append(str2);
+    cout << "Rope Slice: " << rope.slice(3, 9) << endl;
+    cout << "Rope Concatenation: " << rope.str() << endl;
+    // Appending a temporary rope moves its owned strings (short ones inline)
+    auto makePart = [](int i) {
+        StringRope part;
+        part.append(to_string(i)).append(string(i % 2 ? "-odd;" : "-even-and-long-enough-to-leave-sso;"));
+        return part;
+    };
+    StringRope log;
+    string expected;
+    for (int i = 0; i < 4; ++i) {
+        log.append(makePart(i));
+        expected += to_string(i) + (i % 2 ? "-odd;" : "-even-and-long-enough-to-leave-sso;");
+    }
+    cout << "Rope of temporaries: " << (log.str() == expected ? "ok" : "FAILED") << endl;
     cout << "Comparison: " << (StringOperations::compare(str1, str2) ? "Equal" : "Not Equal") << endl;
 
+    StringPool pool;
+    InternedString id1 = pool.intern(str1), id2 = pool.intern(string("hel") + "lo");
+    cout << "Interned Comparison: " << (StringOperations::compare(id1, id2) ? "Equal" : "Not Equal") << endl;
+    unordered_map<InternedString, int> visits;
+    visits[id1]++;
+    visits[id2]++;
+    cout << "Visits keyed by handle: " << visits[pool.find("hello")] << endl;
+
     unordered_map<char, int> freq = StringOperations::characterFrequency("hello");
     cout << "Character Frequency:\n";
     for (auto &pair : freq) {
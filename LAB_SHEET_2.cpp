@@ -1,63 +1,740 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <queue>
+#include <cstdint>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 using namespace std;
 
+// Non-owning strided view over matrix storage; element (i, j) lives at
+// data[i * rowStride + j * colStride]. Invalidated by any call that
+// reallocates the owning matrix.
+struct MatrixView {
+    int* data;
+    size_t rows, cols, rowStride, colStride;
+
+    int& operator()(size_t i, size_t j) const {
+        return data[i * rowStride + j * colStride];
+    }
+
+    MatrixView subMatrix(size_t row, size_t col, size_t numRows, size_t numCols) const {
+        return {&(*this)(row, col), numRows, numCols, rowStride, colStride};
+    }
+};
+
+// Runs body(t) for t in [0, threads) on separate threads (inline if 1)
+template <typename Body>
+void runParallel(unsigned threads, Body body) {
+    if (threads <= 1) {
+        body(0u);
+        return;
+    }
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back(body, t);
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Cache-blocked Matrix Transpose
+// The matrix is walked in TILE x TILE tiles so both source rows and
+// destination rows stay cache-resident; each tile is transposed by 8x8
+// register kernels (AVX2 unpack/permute with -mavx2, otherwise four SSE2
+// 4x4 transposes). Tile rows are dealt round-robin to threads, using no
+// more threads than there are PARALLEL_GRAIN-element chunks of work.
+class MatrixTranspose {
+private:
+    static constexpr size_t TILE = 64;
+    static constexpr size_t PARALLEL_GRAIN = 1 << 16;
+
+    static unsigned threadsFor(size_t elements, size_t tileRows, unsigned threads) {
+        return (unsigned)max<size_t>(1, min<size_t>({threads, tileRows, elements / PARALLEL_GRAIN}));
+    }
+
+    static void kernel8x8(const int* src, size_t srcStride, int* dst, size_t dstStride) {
+#ifdef __AVX2__
+        __m256i r[8], t[8];
+        for (int i = 0; i < 8; ++i) {
+            r[i] = _mm256_loadu_si256((const __m256i*)(src + i * srcStride));
+        }
+        for (int i = 0; i < 8; i += 2) {
+            t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+            t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+        }
+        for (int i = 0; i < 8; i += 4) {
+            r[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+            r[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+            r[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+            r[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+        }
+        for (int i = 0; i < 4; ++i) {
+            _mm256_storeu_si256((__m256i*)(dst + i * dstStride), _mm256_permute2x128_si256(r[i], r[i + 4], 0x20));
+            _mm256_storeu_si256((__m256i*)(dst + (i + 4) * dstStride), _mm256_permute2x128_si256(r[i], r[i + 4], 0x31));
+        }
+#elif defined(__SSE2__)
+        for (int bi = 0; bi < 8; bi += 4) {
+            for (int bj = 0; bj < 8; bj += 4) {
+                const int* s = src + bi * srcStride + bj;
+                __m128i r0 = _mm_loadu_si128((const __m128i*)s);
+                __m128i r1 = _mm_loadu_si128((const __m128i*)(s + srcStride));
+                __m128i r2 = _mm_loadu_si128((const __m128i*)(s + 2 * srcStride));
+                __m128i r3 = _mm_loadu_si128((const __m128i*)(s + 3 * srcStride));
+                __m128i t0 = _mm_unpacklo_epi32(r0, r1), t1 = _mm_unpackhi_epi32(r0, r1);
+                __m128i t2 = _mm_unpacklo_epi32(r2, r3), t3 = _mm_unpackhi_epi32(r2, r3);
+                int* d = dst + bj * dstStride + bi;
+                _mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi64(t0, t2));
+                _mm_storeu_si128((__m128i*)(d + dstStride), _mm_unpackhi_epi64(t0, t2));
+                _mm_storeu_si128((__m128i*)(d + 2 * dstStride), _mm_unpacklo_epi64(t1, t3));
+                _mm_storeu_si128((__m128i*)(d + 3 * dstStride), _mm_unpackhi_epi64(t1, t3));
+            }
+        }
+#else
+        for (size_t i = 0; i < 8; ++i) {
+            for (size_t j = 0; j < 8; ++j) {
+                dst[j * dstStride + i] = src[i * srcStride + j];
+            }
+        }
+#endif
+    }
+
+    static void transposeTile(const int* src, size_t srcStride, int* dst, size_t dstStride,
+                              size_t r0, size_t r1, size_t c0, size_t c1) {
+        size_t i = r0;
+        for (; i + 8 <= r1; i += 8) {
+            size_t j = c0;
+            for (; j + 8 <= c1; j += 8) {
+                kernel8x8(src + i * srcStride + j, srcStride, dst + j * dstStride + i, dstStride);
+            }
+            for (size_t ii = i; ii < i + 8; ++ii) {
+                for (size_t jj = j; jj < c1; ++jj) {
+                    dst[jj * dstStride + ii] = src[ii * srcStride + jj];
+                }
+            }
+        }
+        for (; i < r1; ++i) {
+            for (size_t j = c0; j < c1; ++j) {
+                dst[j * dstStride + i] = src[i * srcStride + j];
+            }
+        }
+    }
+
+public:
+    static const char* kernelName() {
+#ifdef __AVX2__
+        return "AVX2";
+#elif defined(__SSE2__)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+    // dst (cols x rows, row stride dstStride) = transpose of src (rows x cols)
+    static void transpose(const int* src, size_t rows, size_t cols, size_t srcStride,
+                          int* dst, size_t dstStride, unsigned threads = 1) {
+        size_t tileRows = (rows + TILE - 1) / TILE;
+        threads = threadsFor(rows * cols, tileRows, threads);
+        runParallel(threads, [=](unsigned t) {
+            for (size_t ti = t; ti < tileRows; ti += threads) {
+                size_t r0 = ti * TILE, r1 = min(rows, r0 + TILE);
+                for (size_t c0 = 0; c0 < cols; c0 += TILE) {
+                    transposeTile(src, srcStride, dst, dstStride, r0, r1, c0, min(cols, c0 + TILE));
+                }
+            }
+        });
+    }
+
+    // In-place transpose of an n x n matrix: mirrored tile pairs are
+    // transposed through two stack buffers and written back swapped.
+    // Thread t owns tile rows t, t + threads, ... and only the pairs (i, j)
+    // with j >= i, so no two threads touch the same tile.
+    static void transposeSquareInPlace(int* data, size_t n, size_t stride, unsigned threads = 1) {
+        size_t tiles = (n + TILE - 1) / TILE;
+        threads = threadsFor(n * n, tiles, threads);
+        runParallel(threads, [=](unsigned t) {
+            vector<int> upper(TILE * TILE), lower(TILE * TILE);
+            for (size_t ti = t; ti < tiles; ti += threads) {
+                size_t r0 = ti * TILE, r1 = min(n, r0 + TILE);
+                for (size_t tj = ti; tj < tiles; ++tj) {
+                    size_t c0 = tj * TILE, c1 = min(n, c0 + TILE);
+                    // upper holds transpose of tile (ti, tj), lower of (tj, ti)
+                    transposeTile(data + r0 * stride + c0, stride, upper.data(), TILE, 0, r1 - r0, 0, c1 - c0);
+                    transposeTile(data + c0 * stride + r0, stride, lower.data(), TILE, 0, c1 - c0, 0, r1 - r0);
+                    for (size_t j = 0; j < c1 - c0; ++j) {
+                        copy_n(&upper[j * TILE], r1 - r0, data + (c0 + j) * stride + r0);
+                    }
+                    if (tj == ti) continue;
+                    for (size_t i = 0; i < r1 - r0; ++i) {
+                        copy_n(&lower[i * TILE], c1 - c0, data + (r0 + i) * stride + c0);
+                    }
+                }
+            }
+        });
+    }
+};
+
+// Blocked Integer Matrix Multiply
+// Goto-style GEMM: B is packed into KC x NR column panels and A into
+// MR x KC row panels (both zero-padded), so the MR x NR micro-kernel reads
+// two unit-stride streams and keeps the C tile in registers. Rows of C are
+// split into contiguous bands, one per thread, each with its own packing
+// buffers. Arithmetic wraps like the hardware does. The micro-kernel uses
+// AVX2 with -mavx2; plain SSE2 has no 32-bit mullo, so it accumulates
+// even and odd columns separately with 32x32->64 multiplies instead.
+class MatrixMultiply {
+private:
+    static constexpr size_t MR = 4, NR = 8, MC = 64, KC = 256, NC = 512;
+
+    // c[MR x NR] = sum over p of a[p * MR + r] * b[p * NR + j]
+    static void microKernel(size_t kc, const int* a, const int* b, int* c) {
+#ifdef __AVX2__
+        __m256i acc[MR];
+        for (size_t r = 0; r < MR; ++r) acc[r] = _mm256_setzero_si256();
+        for (size_t p = 0; p < kc; ++p) {
+            __m256i row = _mm256_loadu_si256((const __m256i*)(b + p * NR));
+            for (size_t r = 0; r < MR; ++r) {
+                acc[r] = _mm256_add_epi32(acc[r], _mm256_mullo_epi32(_mm256_set1_epi32(a[p * MR + r]), row));
+            }
+        }
+        for (size_t r = 0; r < MR; ++r) {
+            _mm256_storeu_si256((__m256i*)(c + r * NR), acc[r]);
+        }
+#elif defined(__SSE2__)
+        // One 4-column half at a time: even[r] and odd[r] hold columns
+        // {0, 2} and {1, 3} of row r in the low halves of 64-bit lanes, and
+        // only those 32 bits are kept.
+        for (size_t h = 0; h < NR; h += 4) {
+            __m128i even[MR], odd[MR];
+            for (size_t r = 0; r < MR; ++r) even[r] = odd[r] = _mm_setzero_si128();
+            for (size_t p = 0; p < kc; ++p) {
+                __m128i row = _mm_loadu_si128((const __m128i*)(b + p * NR + h));
+                __m128i rowOdd = _mm_srli_epi64(row, 32);
+                for (size_t r = 0; r < MR; ++r) {
+                    __m128i s = _mm_set1_epi32(a[p * MR + r]);
+                    even[r] = _mm_add_epi32(even[r], _mm_mul_epu32(s, row));
+                    odd[r] = _mm_add_epi32(odd[r], _mm_mul_epu32(s, rowOdd));
+                }
+            }
+            for (size_t r = 0; r < MR; ++r) {
+                __m128i e = _mm_shuffle_epi32(even[r], _MM_SHUFFLE(0, 0, 2, 0));
+                __m128i o = _mm_shuffle_epi32(odd[r], _MM_SHUFFLE(0, 0, 2, 0));
+                _mm_storeu_si128((__m128i*)(c + r * NR + h), _mm_unpacklo_epi32(e, o));
+            }
+        }
+#else
+        unsigned acc[MR * NR] = {};
+        for (size_t p = 0; p < kc; ++p) {
+            for (size_t r = 0; r < MR; ++r) {
+                for (size_t j = 0; j < NR; ++j) {
+                    acc[r * NR + j] += (unsigned)a[p * MR + r] * (unsigned)b[p * NR + j];
+                }
+            }
+        }
+        for (size_t i = 0; i < MR * NR; ++i) c[i] = acc[i];
+#endif
+    }
+
+    static void multiplyBand(const int* A, size_t lda, const int* B, size_t ldb, int* C, size_t ldc,
+                             size_t m0, size_t m1, size_t n, size_t k) {
+        vector<int> packedA(MC * KC), packedB(KC * NC), tile(MR * NR);
+        for (size_t jc = 0; jc < n; jc += NC) {
+            size_t nc = min(NC, n - jc);
+            for (size_t pc = 0; pc < k; pc += KC) {
+                size_t kc = min(KC, k - pc);
+                for (size_t jr = 0; jr < nc; jr += NR) {
+                    int* panel = &packedB[jr * kc];
+                    for (size_t p = 0; p < kc; ++p) {
+                        for (size_t j = 0; j < NR; ++j) {
+                            panel[p * NR + j] = jr + j < nc ? B[(pc + p) * ldb + jc + jr + j] : 0;
+                        }
+                    }
+                }
+                for (size_t ic = m0; ic < m1; ic += MC) {
+                    size_t mc = min(MC, m1 - ic);
+                    for (size_t ir = 0; ir < mc; ir += MR) {
+                        int* panel = &packedA[ir * kc];
+                        for (size_t p = 0; p < kc; ++p) {
+                            for (size_t r = 0; r < MR; ++r) {
+                                panel[p * MR + r] = ir + r < mc ? A[(ic + ir + r) * lda + pc + p] : 0;
+                            }
+                        }
+                    }
+                    for (size_t jr = 0; jr < nc; jr += NR) {
+                        for (size_t ir = 0; ir < mc; ir += MR) {
+                            microKernel(kc, &packedA[ir * kc], &packedB[jr * kc], tile.data());
+                            size_t rows = min(MR, mc - ir), cols = min(NR, nc - jr);
+                            for (size_t r = 0; r < rows; ++r) {
+                                unsigned* out = (unsigned*)&C[(ic + ir + r) * ldc + jc + jr];
+                                for (size_t j = 0; j < cols; ++j) {
+                                    out[j] += (unsigned)tile[r * NR + j];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+public:
+    static const char* kernelName() {
+#ifdef __AVX2__
+        return "AVX2";
+#elif defined(__SSE2__)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+    // C (m x n, zero-initialized by the caller) += A (m x k) * B (k x n)
+    static void multiply(const int* A, size_t lda, const int* B, size_t ldb, int* C, size_t ldc,
+                         size_t m, size_t n, size_t k, unsigned threads = 1) {
+        threads = max(1u, min<unsigned>(threads, (m + MR - 1) / MR));
+        size_t band = ((m + threads - 1) / threads + MR - 1) / MR * MR;
+        runParallel(threads, [=](unsigned t) {
+            size_t m0 = min(m, t * band), m1 = min(m, m0 + band);
+            if (m0 < m1) multiplyBand(A, lda, B, ldb, C, ldc, m0, m1, n, k);
+        });
+    }
+};
+
+// Allocator whose value-less construct leaves trivial types uninitialized,
+// so resize(n) on a buffer about to be overwritten skips the zero fill
+template <typename T>
+struct DefaultInitAllocator : allocator<T> {
+    template <typename U>
+    struct rebind {
+        using other = DefaultInitAllocator<U>;
+    };
+
+    DefaultInitAllocator() = default;
+    template <typename U>
+    DefaultInitAllocator(const DefaultInitAllocator<U>&) {}
+
+    template <typename U>
+    void construct(U* p) {
+        ::new (static_cast<void*>(p)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
 // Class for 2D Array Operations
+// Row-major in one contiguous buffer. Rows are `stride` ints apart with
+// stride >= cols; the slack lets insertColumn append in place and only
+// relayout (doubling the stride) when it runs out.
 class TwoDimensionalArray {
 private:
-    vector<vector<int>> matrix;
+    using Buffer = vector<int, DefaultInitAllocator<int>>;
+
+    Buffer data;
+    size_t rows, cols, stride;
+
+    void reserveColumns(size_t needed) {
+        if (needed <= stride) return;
+        size_t newStride = max(needed, max<size_t>(stride * 2, 4));
+        Buffer grown(rows * newStride, 0);
+        for (size_t i = 0; i < rows; ++i) {
+            copy(data.begin() + i * stride, data.begin() + i * stride + cols, grown.begin() + i * newStride);
+        }
+        data.swap(grown);
+        stride = newStride;
+    }
 
 public:
+    TwoDimensionalArray() : rows(0), cols(0), stride(0) {}
+
+    TwoDimensionalArray(size_t rows, size_t cols, int fillValue = 0)
+        : data(rows * cols, fillValue), rows(rows), cols(cols), stride(cols) {}
+
+    size_t rowCount() const {
+        return rows;
+    }
+
+    size_t columnCount() const {
+        return cols;
+    }
+
+    int& at(size_t i, size_t j) {
+        return data[i * stride + j];
+    }
+
+    MatrixView view() {
+        return {data.data(), rows, cols, stride, 1};
+    }
+
+    MatrixView row(size_t i) {
+        return view().subMatrix(i, 0, 1, cols);
+    }
+
+    MatrixView column(size_t j) {
+        return view().subMatrix(0, j, rows, 1);
+    }
+
+    // Rows shorter than the matrix are zero-padded, longer ones truncated
     void insertRow(vector<int> row) {
-        matrix.push_back(row);
+        if (rows == 0) {
+            cols = 0;
+            reserveColumns(row.size());
+            cols = row.size();
+        }
+        data.resize((rows + 1) * stride, 0);
+        copy_n(row.begin(), min(row.size(), cols), data.begin() + rows * stride);
+        rows++;
     }
 
     void insertColumn(vector<int> column) {
-        if (matrix.empty()) {
+        if (rows == 0) {
             for (int value : column) {
-                matrix.push_back({value});
+                insertRow({value});
             }
         } else {
-            for (size_t i = 0; i < matrix.size() && i < column.size(); ++i) {
-                matrix[i].push_back(column[i]);
+            reserveColumns(cols + 1);
+            for (size_t i = 0; i < rows; ++i) {
+                data[i * stride + cols] = i < column.size() ? column[i] : 0;
             }
+            cols++;
         }
     }
 
     void deleteRow(int index) {
-        if (index >= 0 && index < matrix.size()) {
-            matrix.erase(matrix.begin() + index);
+        if (index >= 0 && index < (int)rows) {
+            data.erase(data.begin() + index * stride, data.begin() + (index + 1) * stride);
+            rows--;
         } else {
             cout << "Invalid row index\n";
         }
     }
 
     void traverse() {
-        for (const auto& row : matrix) {
-            for (int value : row) {
-                cout << value << " ";
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                cout << data[i * stride + j] << " ";
             }
             cout << endl;
         }
     }
 
+    TwoDimensionalArray transposed(unsigned threads = 1) {
+        TwoDimensionalArray result;
+        result.rows = cols;
+        result.cols = result.stride = rows;
+        result.data.resize(rows * cols); // uninitialized, every element is written below
+        MatrixTranspose::transpose(data.data(), rows, cols, stride, result.data.data(), rows, threads);
+        return result;
+    }
+
+    void transposeInPlace(unsigned threads = 1) {
+        if (rows == cols) {
+            MatrixTranspose::transposeSquareInPlace(data.data(), rows, stride, threads);
+        } else {
+            *this = transposed(threads);
+        }
+    }
+
+    TwoDimensionalArray multiply(const TwoDimensionalArray& other, unsigned threads = 1) const {
+        if (cols != other.rows) {
+            cout << "Dimension mismatch\n";
+            return TwoDimensionalArray();
+        }
+        TwoDimensionalArray result(rows, other.cols);
+        MatrixMultiply::multiply(data.data(), stride, other.data.data(), other.stride, result.data.data(),
+                                 result.stride, rows, other.cols, cols, threads);
+        return result;
+    }
+
+    vector<int> multiplyVector(const vector<int>& v) const {
+        if (cols != v.size()) {
+            cout << "Dimension mismatch\n";
+            return {};
+        }
+        vector<int> result(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            const int* row = &data[i * stride];
+            unsigned sum = 0;
+            for (size_t j = 0; j < cols; ++j) {
+                sum += (unsigned)row[j] * (unsigned)v[j];
+            }
+            result[i] = sum;
+        }
+        return result;
+    }
+
+    // Elementwise kernels run over contiguous rows and auto-vectorize
+    TwoDimensionalArray add(const TwoDimensionalArray& other) const {
+        if (rows != other.rows || cols != other.cols) {
+            cout << "Dimension mismatch\n";
+            return TwoDimensionalArray();
+        }
+        TwoDimensionalArray result(rows, cols);
+        for (size_t i = 0; i < rows; ++i) {
+            const int* a = &data[i * stride];
+            const int* b = &other.data[i * other.stride];
+            int* out = &result.data[i * cols];
+            for (size_t j = 0; j < cols; ++j) {
+                out[j] = (unsigned)a[j] + (unsigned)b[j];
+            }
+        }
+        return result;
+    }
+
+    void scale(int factor) {
+        for (size_t i = 0; i < rows; ++i) {
+            int* row = &data[i * stride];
+            for (size_t j = 0; j < cols; ++j) {
+                row[j] = (unsigned)row[j] * (unsigned)factor;
+            }
+        }
+    }
+
     vector<vector<int>> transposeMatrix() {
-        if (matrix.empty()) return {};
-        size_t rows = matrix.size(), cols = matrix[0].size();
+        if (rows == 0) return {};
         vector<vector<int>> transpose(cols, vector<int>(rows));
         for (size_t i = 0; i < rows; ++i) {
             for (size_t j = 0; j < cols; ++j) {
-                transpose[j][i] = matrix[i][j];
+                transpose[j][i] = data[i * stride + j];
             }
         }
         return transpose;
     }
 };
 
+// Binary Run Length Codec
+// Each run is written as its byte value followed by the run length as an
+// LEB128 varint, so any byte (digits included) round-trips. Both sides are
+// streaming: runs and partial varints carry over between feed() calls.
+class RleEncoder {
+private:
+    unsigned char value;
+    uint64_t count;
+
+    // Length of the run of `c` starting at data[0], capped at n
+    static size_t runLength(const unsigned char* data, size_t n, unsigned char c) {
+        size_t i = 0;
+#ifdef __AVX2__
+        const __m256i broadcast = _mm256_set1_epi8(c);
+        for (; i + 32 <= n; i += 32) {
+            __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+            uint32_t differs = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, broadcast));
+            if (differs) return i + __builtin_ctz(differs);
+        }
+#endif
+        const uint64_t pattern = 0x0101010101010101ULL * c;
+        for (; i + 8 <= n; i += 8) {
+            uint64_t word;
+            memcpy(&word, data + i, 8);
+            if (word != pattern) return i + __builtin_ctzll(word ^ pattern) / 8; // little-endian
+        }
+        while (i < n && data[i] == c) ++i;
+        return i;
+    }
+
+    void flush(string& out) {
+        out.push_back(value);
+        uint64_t n = count;
+        while (n >= 0x80) {
+            out.push_back((char)(n | 0x80));
+            n >>= 7;
+        }
+        out.push_back((char)n);
+        count = 0;
+    }
+
+public:
+    RleEncoder() : value(0), count(0) {}
+
+    void feed(const char* data, size_t n, string& out) {
+        const unsigned char* bytes = (const unsigned char*)data;
+        size_t i = 0;
+        while (i < n) {
+            if (count == 0) value = bytes[i];
+            size_t run = runLength(bytes + i, n - i, value);
+            if (run == 0) {
+                flush(out);
+                continue;
+            }
+            count += run;
+            i += run;
+        }
+    }
+
+    void finish(string& out) {
+        if (count) flush(out);
+    }
+};
+
+class RleDecoder {
+private:
+    bool haveValue;
+    char value;
+    uint64_t count;
+    int shift;
+    uint64_t remaining; // output bytes still allowed
+
+public:
+    // maxOutput bounds the total decoded size, so a corrupt run length is
+    // rejected instead of being handed to string::append
+    RleDecoder(uint64_t maxOutput = 1ULL << 30)
+        : haveValue(false), value(0), count(0), shift(0), remaining(maxOutput) {}
+
+    // Returns false on a malformed stream (varint wider than 64 bits) or a
+    // run that would exceed maxOutput
+    bool feed(const char* data, size_t n, string& out) {
+        for (size_t i = 0; i < n; ++i) {
+            if (!haveValue) {
+                value = data[i];
+                haveValue = true;
+                continue;
+            }
+            unsigned char b = data[i];
+            if (shift == 63 && b > 1) return false;
+            count |= (uint64_t)(b & 0x7f) << shift;
+            shift += 7;
+            if (!(b & 0x80)) {
+                if (count > remaining || count > out.max_size() - out.size()) return false;
+                out.append(count, value);
+                remaining -= count;
+                haveValue = false;
+                count = 0;
+                shift = 0;
+            }
+        }
+        return true;
+    }
+
+    // False if the stream ended in the middle of a run
+    bool finish() const {
+        return !haveValue;
+    }
+};
+
 // String Algorithms
 class StringAlgorithms {
 public:
+    struct Match {
+        size_t position; // start offset in the text
+        int pattern;     // index into the compiled pattern list
+    };
+
+    // Compiled Aho-Corasick automaton. Bytes are folded into the classes
+    // that actually occur in the patterns (class 0 = any other byte), and
+    // the goto function is completed into a dense states x classes table,
+    // so scanning is one table load per text byte with no failure chasing.
+    class PatternSet {
+    private:
+        vector<string> patterns;
+        uint16_t byteClass[256]; // up to 256 classes plus class 0
+        int classes;
+        vector<int> next;        // next[state * classes + class]
+        vector<int> outputStart; // outputs of state s: [outputStart[s], outputStart[s + 1])
+        vector<int> outputs;
+
+    public:
+        explicit PatternSet(const vector<string>& patternList) : patterns(patternList), classes(1) {
+            fill(begin(byteClass), end(byteClass), 0);
+            for (const string& p : patterns) {
+                for (unsigned char c : p) {
+                    if (!byteClass[c]) byteClass[c] = classes++;
+                }
+            }
+
+            // Trie, with -1 marking missing edges
+            next.assign(classes, -1);
+            vector<vector<int>> ends(1);
+            for (size_t id = 0; id < patterns.size(); ++id) {
+                int state = 0;
+                for (unsigned char c : patterns[id]) {
+                    int& edge = next[state * classes + byteClass[c]];
+                    if (edge == -1) {
+                        edge = ends.size();
+                        ends.emplace_back();
+                        next.resize(next.size() + classes, -1);
+                    }
+                    state = next[state * classes + byteClass[c]];
+                }
+                ends[state].push_back(id);
+            }
+
+            // BFS: fill missing edges from the failure state and inherit its outputs
+            size_t states = ends.size();
+            vector<int> fail(states, 0), order;
+            queue<int> pending;
+            for (int c = 0; c < classes; ++c) {
+                int& edge = next[c];
+                if (edge == -1) {
+                    edge = 0;
+                } else {
+                    pending.push(edge);
+                }
+            }
+            while (!pending.empty()) {
+                int state = pending.front();
+                pending.pop();
+                order.push_back(state);
+                for (int c = 0; c < classes; ++c) {
+                    int& edge = next[state * classes + c];
+                    if (edge == -1) {
+                        edge = next[fail[state] * classes + c];
+                    } else {
+                        fail[edge] = next[fail[state] * classes + c];
+                        pending.push(edge);
+                    }
+                }
+            }
+            for (int state : order) {
+                const vector<int>& inherited = ends[fail[state]];
+                ends[state].insert(ends[state].end(), inherited.begin(), inherited.end());
+            }
+
+            outputStart.push_back(0);
+            for (const vector<int>& e : ends) {
+                outputs.insert(outputs.end(), e.begin(), e.end());
+                outputStart.push_back(outputs.size());
+            }
+        }
+
+        const string& pattern(int id) const {
+            return patterns[id];
+        }
+
+        // Every occurrence of every pattern, ordered by end position
+        vector<Match> findAll(const string& text) const {
+            vector<Match> matches;
+            int state = 0;
+            for (size_t i = 0; i < text.size(); ++i) {
+                state = next[state * classes + byteClass[(unsigned char)text[i]]];
+                for (int k = outputStart[state]; k < outputStart[state + 1]; ++k) {
+                    matches.push_back({i + 1 - patterns[outputs[k]].size(), outputs[k]});
+                }
+            }
+            return matches;
+        }
+    };
+
+    static PatternSet compilePatterns(const vector<string>& patterns) {
+        return PatternSet(patterns);
+    }
+
     static vector<int> computeLPS(const string& pattern) {
         size_t m = pattern.size();
         vector<int> lps(m, 0);
@@ -92,6 +769,148 @@ public:
         return -1; // Pattern not found
     }
 
+    // Pattern with its LPS table built once, reusable across texts and files
+    struct KmpPattern {
+        string pattern;
+        vector<int> lps;
+
+        explicit KmpPattern(const string& p) : pattern(p), lps(computeLPS(p)) {}
+
+        // Appends base + offset of every match in data[0, n), overlaps included
+        void findAll(const char* data, size_t n, size_t base, vector<size_t>& out) const {
+            size_t m = pattern.size();
+            if (m == 0) return;
+            size_t j = 0;
+            for (size_t i = 0; i < n;) {
+                if (data[i] == pattern[j]) {
+                    ++i;
+                    ++j;
+                    if (j == m) {
+                        out.push_back(base + i - m);
+                        j = lps[j - 1];
+                    }
+                } else if (j) {
+                    j = lps[j - 1];
+                } else {
+                    ++i;
+                }
+            }
+        }
+    };
+
+    static vector<size_t> knuthMorrisPrattAll(const string& text, const string& pattern) {
+        vector<size_t> matches;
+        KmpPattern(pattern).findAll(text.data(), text.size(), 0, matches);
+        return matches;
+    }
+
+    // Every match offset in a file, in order. The file is mmap'd and cut
+    // into chunkSize pieces, each extended by m - 1 bytes so matches that
+    // straddle a boundary are seen exactly once (by the chunk they start
+    // in). Worker threads claim chunks from a shared counter. chunkSize is
+    // clamped to [m, file size].
+    static vector<size_t> findAllInFile(const string& path, const KmpPattern& kmp,
+                                        unsigned threads = thread::hardware_concurrency(),
+                                        size_t chunkSize = size_t(16) << 20) {
+        vector<size_t> matches;
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            cout << "Cannot open " << path << "\n";
+            return matches;
+        }
+        struct stat info;
+        size_t n = fstat(fd, &info) == 0 ? info.st_size : 0;
+        size_t m = kmp.pattern.size();
+        if (n == 0 || m == 0 || n < m) {
+            close(fd);
+            return matches;
+        }
+        void* mapped = mmap(nullptr, n, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) {
+            cout << "Cannot map " << path << "\n";
+            return matches;
+        }
+        const char* data = (const char*)mapped;
+        madvise(mapped, n, MADV_SEQUENTIAL);
+
+        chunkSize = min(max(chunkSize, m), n);
+        size_t chunks = (n + chunkSize - 1) / chunkSize;
+        vector<vector<size_t>> perChunk(chunks);
+        atomic<size_t> nextChunk(0);
+        runParallel(max(1u, threads), [&](unsigned) {
+            for (size_t c = nextChunk++; c < chunks; c = nextChunk++) {
+                size_t start = c * chunkSize;
+                size_t end = min(n, start + chunkSize + m - 1);
+                kmp.findAll(data + start, end - start, start, perChunk[c]);
+            }
+        });
+        munmap(mapped, n);
+
+        for (vector<size_t>& part : perChunk) {
+            matches.insert(matches.end(), part.begin(), part.end());
+        }
+        return matches;
+    }
+
+    // First match at or after `from`, picking the strategy from the pattern:
+    // memchr for one byte; otherwise a first/last-byte candidate filter
+    // (32 positions per AVX2 step, memchr-driven without AVX2) verified by
+    // memcmp. If verification keeps failing the text is match-dense, so the
+    // scan hands off to KMP, which never re-reads a byte.
+    static int find(const string& text, const string& pattern, size_t from = 0) {
+        size_t n = text.size(), m = pattern.size();
+        if (m == 0) return from <= n ? from : -1;
+        if (n < m || from > n - m) return -1;
+        const char* t = text.data();
+        const char* p = pattern.data();
+        if (m == 1) {
+            const void* hit = memchr(t + from, p[0], n - from);
+            return hit ? (const char*)hit - t : -1;
+        }
+
+        size_t i = from, last = n - m; // candidate starts are [from, last]
+        size_t misses = 0;
+        auto tooManyMisses = [&] { return misses > 64 + (i - from) / 16; };
+#ifdef __AVX2__
+        const __m256i first = _mm256_set1_epi8(p[0]), final = _mm256_set1_epi8(p[m - 1]);
+        for (; i + 32 <= last + 1 && !tooManyMisses(); i += 32) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(t + i));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(t + i + m - 1));
+            uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, final)));
+            for (; mask; mask &= mask - 1) {
+                size_t candidate = i + __builtin_ctz(mask);
+                if (memcmp(t + candidate + 1, p + 1, m - 2) == 0) return candidate;
+                misses++;
+            }
+        }
+#endif
+        while (i <= last && !tooManyMisses()) {
+            const char* hit = (const char*)memchr(t + i, p[0], last + 1 - i);
+            if (!hit) return -1;
+            i = hit - t;
+            if (t[i + m - 1] == p[m - 1] && memcmp(t + i + 1, p + 1, m - 2) == 0) return i;
+            misses++;
+            i++;
+        }
+        if (i > last) return -1;
+
+        KmpPattern kmp(pattern);
+        size_t j = 0;
+        while (i < n) {
+            if (t[i] == p[j]) {
+                ++i;
+                ++j;
+                if (j == m) return i - m;
+            } else if (j) {
+                j = kmp.lps[j - 1];
+            } else {
+                ++i;
+            }
+        }
+        return -1;
+    }
+
     static string runLengthEncoding(const string& str) {
         string encoded = "";
         size_t count = 1;
@@ -105,8 +924,117 @@ public:
         }
         return encoded;
     }
+
+    static string runLengthEncodeBinary(const string& str) {
+        string encoded;
+        RleEncoder encoder;
+        encoder.feed(str.data(), str.size(), encoded);
+        encoder.finish(encoded);
+        return encoded;
+    }
+
+    static string runLengthDecodeBinary(const string& encoded) {
+        string decoded;
+        RleDecoder decoder;
+        if (!decoder.feed(encoded.data(), encoded.size(), decoded) || !decoder.finish()) {
+            cout << "Malformed run length stream\n";
+        }
+        return decoded;
+    }
 };
 
+// Naive transposeMatrix vs tiled transpose (1 thread, all threads, in place)
+void benchmarkTranspose() {
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    cout << "8x8 kernels: " << MatrixTranspose::kernelName() << endl;
+    for (size_t n : {256, 1024, 2048, 4096}) {
+        TwoDimensionalArray m;
+        vector<int> row(n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) row[j] = i * n + j;
+            m.insertRow(row);
+        }
+        auto time = [](auto fn) {
+            auto start = chrono::steady_clock::now();
+            fn();
+            return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        };
+        long naive = time([&] { m.transposeMatrix(); });
+        long tiled = time([&] { m.transposed(); });
+        long parallel = time([&] { m.transposed(threads); });
+        long inPlace = time([&] { m.transposeInPlace(threads); });
+        cout << n << "x" << n << ": naive " << naive << " us, tiled " << tiled << " us, tiled x"
+             << threads << " " << parallel << " us, in-place x" << threads << " " << inPlace << " us\n";
+    }
+}
+
+// Naive i-j-k triple loop vs blocked multiply (1 thread and all threads)
+void benchmarkMultiply() {
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    cout << "Micro-kernel: " << MatrixMultiply::kernelName() << endl;
+    mt19937 rng(11);
+    for (size_t n : {128, 256, 512}) {
+        TwoDimensionalArray a(n, n), b(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                a.at(i, j) = rng() % 100;
+                b.at(i, j) = rng() % 100;
+            }
+        }
+        auto start = chrono::steady_clock::now();
+        TwoDimensionalArray naive(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                int sum = 0;
+                for (size_t k = 0; k < n; ++k) sum += a.at(i, k) * b.at(k, j);
+                naive.at(i, j) = sum;
+            }
+        }
+        auto mid = chrono::steady_clock::now();
+        TwoDimensionalArray blocked = a.multiply(b);
+        auto end = chrono::steady_clock::now();
+        TwoDimensionalArray parallel = a.multiply(b, threads);
+        auto endParallel = chrono::steady_clock::now();
+        bool same = true;
+        for (size_t i = 0; i < n && same; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                same = same && naive.at(i, j) == blocked.at(i, j) && naive.at(i, j) == parallel.at(i, j);
+            }
+        }
+        auto us = [](auto d) { return chrono::duration_cast<chrono::microseconds>(d).count(); };
+        cout << n << "x" << n << ": naive " << us(mid - start) << " us, blocked " << us(end - mid)
+             << " us, blocked x" << threads << " " << us(endParallel - end) << " us, "
+             << (same ? "same result" : "MISMATCH") << endl;
+    }
+}
+
+// knuthMorrisPratt vs find on sparse- and dense-candidate corpora
+void benchmarkSearch() {
+    const size_t n = size_t(32) << 20;
+    mt19937 rng(7);
+    string sparse(n, ' '), dense(n, ' ');
+    for (size_t i = 0; i < n; ++i) {
+        sparse[i] = 'a' + rng() % 25; // never 'z'
+        dense[i] = "ab"[rng() % 2];
+    }
+    string sparsePattern = "zebra", densePattern = "abababbbabaaabbabbbaababbbaabababbbaabab";
+    sparse.replace(n - sparsePattern.size(), sparsePattern.size(), sparsePattern);
+    dense.replace(n - densePattern.size(), densePattern.size(), densePattern);
+    auto time = [](auto fn) {
+        auto start = chrono::steady_clock::now();
+        int result = fn();
+        long us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        return make_pair(result, us);
+    };
+    struct Corpus { const char* name; const string& text; const string& pattern; };
+    for (Corpus c : {Corpus{"sparse", sparse, sparsePattern}, Corpus{"dense", dense, densePattern}}) {
+        auto kmp = time([&] { return StringAlgorithms::knuthMorrisPratt(c.text, c.pattern); });
+        auto fast = time([&] { return StringAlgorithms::find(c.text, c.pattern); });
+        cout << c.name << " (32 MiB): kmp " << kmp.second << " us, find " << fast.second
+             << " us, " << (kmp.first == fast.first ? "same result" : "MISMATCH") << endl;
+    }
+}
+
 // Main Function
 int main() {
     // 2D Array Example
@@ -120,6 +1048,16 @@ int main() {
     cout << "After Deleting Row:\n";
     tdArray.traverse();
 
+    TwoDimensionalArray grid;
+    grid.insertRow({1, 2, 3});
+    grid.insertRow({4, 5, 6});
+    grid.insertColumn({7, 8});
+    MatrixView corner = grid.view().subMatrix(0, 1, 2, 2);
+    cout << "Sub-matrix (rows 0-1, cols 1-2): " << corner(0, 0) << " " << corner(0, 1)
+         << " " << corner(1, 0) << " " << corner(1, 1) << endl;
+    MatrixView lastColumn = grid.column(3);
+    cout << "Column 3: " << lastColumn(0, 0) << " " << lastColumn(1, 0) << endl;
+
     vector<vector<int>> transpose = tdArray.transposeMatrix();
     cout << "Transpose of the Matrix:\n";
     for (const auto& row : transpose) {
@@ -129,6 +1067,25 @@ int main() {
         cout << endl;
     }
 
+    grid.transposeInPlace();
+    cout << "Transposed grid:\n";
+    grid.traverse();
+
+    TwoDimensionalArray product = grid.multiply(grid.transposed());
+    product.scale(2);
+    cout << "2 * (grid x grid^T):\n";
+    product.traverse();
+    vector<int> mv = grid.multiplyVector({1, 1});
+    cout << "grid x [1 1]: ";
+    for (int value : mv) cout << value << " ";
+    cout << endl;
+
+    cout << "\nMultiply Benchmark:\n";
+    benchmarkMultiply();
+
+    cout << "\nTranspose Benchmark:\n";
+    benchmarkTranspose();
+
     // String Pattern Matching Example
     cout << "\nString Pattern Matching Example:\n";
     string text = "abxabcabcaby", pattern = "abcaby";
@@ -139,11 +1096,54 @@ int main() {
         cout << "Pattern not found\n";
     }
 
+    cout << "Prefiltered search found it at index: " << StringAlgorithms::find(text, pattern) << endl;
+    cout << "\nSearch Benchmark:\n";
+    benchmarkSearch();
+
+    // Find-All Over a File Example
+    const char* tmpDir = getenv("TMPDIR");
+    string logPath = string(tmpDir && *tmpDir ? tmpDir : "/tmp") + "/kmp_demo_XXXXXX";
+    int logFd = mkstemp(&logPath[0]);
+    if (logFd < 0) {
+        cout << "Could not create a temporary file\n";
+        return 1;
+    }
+    string logText = "error ok error error ok error";
+    bool written = write(logFd, logText.data(), logText.size()) == (ssize_t)logText.size();
+    close(logFd);
+    if (!written) {
+        remove(logPath.c_str());
+        cout << "Could not write " << logPath << endl;
+        return 1;
+    }
+    StringAlgorithms::KmpPattern errorPattern("error");
+    cout << "All matches of \"error\" in the demo log:";
+    for (size_t offset : StringAlgorithms::findAllInFile(logPath, errorPattern, 2, 8)) {
+        cout << " " << offset;
+    }
+    cout << endl;
+    bool sameMatches = StringAlgorithms::findAllInFile(logPath, errorPattern, 2, 0) ==
+                       StringAlgorithms::findAllInFile(logPath, errorPattern, 2, 8);
+    cout << "Same matches with chunkSize 0: " << (sameMatches ? "yes" : "no") << endl;
+    remove(logPath.c_str());
+
+    // Multi-Pattern Matching Example
+    StringAlgorithms::PatternSet keywords = StringAlgorithms::compilePatterns({"he", "she", "his", "hers"});
+    cout << "Multi-pattern matches in \"ushers\":\n";
+    for (const StringAlgorithms::Match& match : keywords.findAll("ushers")) {
+        cout << keywords.pattern(match.pattern) << " at index " << match.position << endl;
+    }
+
     // Run Length Encoding Example
     cout << "\nRun Length Encoding Example:\n";
     string str = "aaabbbcccaaa";
     string encoded = StringAlgorithms::runLengthEncoding(str);
     cout << "Encoded String: " << encoded << endl;
 
+    string digits = "1112222222222223";
+    string binary = StringAlgorithms::runLengthEncodeBinary(digits);
+    cout << "Binary RLE: " << digits.size() << " bytes -> " << binary.size() << " bytes, round trip "
+         << (StringAlgorithms::runLengthDecodeBinary(binary) == digits ? "ok" : "FAILED") << endl;
+
     return 0;
 }
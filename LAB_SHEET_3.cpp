@@ -2,8 +2,27 @@
 #include <stack>
 #include <queue>
 #include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <functional>
+#include <random>
+#include <condition_variable>
+#include <cstring>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
+const size_t CACHE_LINE = 64;
+
 // Array-based Stack Implementation
 class ArrayStack {
 private:
@@ -53,6 +72,373 @@ public:
     }
 };
 
+// Work-Stealing Deque (Chase-Lev)
+// ArrayStack grown into a deque for task scheduling: the owning thread
+// pushes and pops at the bottom (LIFO, no locks), other threads steal from
+// the top (FIFO) with a CAS on top. The circular array doubles when full;
+// old arrays are kept until destruction because a thief may still be
+// reading one. T must be trivially copyable (typically a pointer).
+template <typename T>
+class WorkStealingDeque {
+private:
+    struct Array {
+        int64_t capacity;
+        unique_ptr<atomic<T>[]> slots;
+
+        Array(int64_t capacity) : capacity(capacity), slots(new atomic<T>[capacity]) {}
+
+        T get(int64_t i) const {
+            return slots[i & (capacity - 1)].load(memory_order_acquire);
+        }
+
+        void put(int64_t i, T value) {
+            slots[i & (capacity - 1)].store(value, memory_order_release);
+        }
+    };
+
+    alignas(CACHE_LINE) atomic<int64_t> top;
+    alignas(CACHE_LINE) atomic<int64_t> bottom;
+    atomic<Array*> array;
+    vector<unique_ptr<Array>> arrays; // owner-only; includes the current one
+
+public:
+    // The capacity is rounded up to a power of two so slots can be masked
+    WorkStealingDeque(int64_t size = 64) : top(0), bottom(0) {
+        int64_t capacity = 1;
+        while (capacity < size) capacity <<= 1;
+        arrays.emplace_back(new Array(capacity));
+        array.store(arrays.back().get());
+    }
+
+    // Owner only
+    void push(T value) {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_acquire);
+        Array* a = array.load(memory_order_relaxed);
+        if (b - t > a->capacity - 1) {
+            Array* grown = new Array(a->capacity * 2);
+            for (int64_t i = t; i < b; ++i) grown->put(i, a->get(i));
+            arrays.emplace_back(grown);
+            array.store(grown, memory_order_release);
+            a = grown;
+        }
+        a->put(b, value);
+        atomic_thread_fence(memory_order_release);
+        bottom.store(b + 1, memory_order_relaxed);
+    }
+
+    // Owner only
+    bool pop(T& value) {
+        int64_t b = bottom.load(memory_order_relaxed) - 1;
+        Array* a = array.load(memory_order_relaxed);
+        bottom.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t t = top.load(memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, memory_order_relaxed);
+            return false;
+        }
+        value = a->get(b);
+        if (t == b) {
+            // Last element: race thieves for it
+            bool won = top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+            bottom.store(b + 1, memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread
+    bool steal(T& value) {
+        int64_t t = top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t b = bottom.load(memory_order_acquire);
+        if (t >= b) return false;
+        Array* a = array.load(memory_order_acquire);
+        value = a->get(t);
+        return top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+    }
+};
+
+// Fork-join bookkeeping: number of spawned tasks not yet finished
+struct TaskGroup {
+    atomic<int> pending{0};
+};
+
+struct PoolTask {
+    function<void()> fn;
+    TaskGroup* group;
+
+    void run() {
+        fn();
+        group->pending.fetch_sub(1, memory_order_release);
+        delete this;
+    }
+};
+
+// Work-Stealing Thread Pool
+// Tasks spawned on a worker go to that worker's deque; tasks spawned from
+// outside go to a locked injection queue. Idle workers pop their own
+// deque, then steal from a random victim, then check the injection queue.
+// wait() runs tasks while it waits, so recursive fork-join cannot deadlock.
+class WorkStealingPool {
+private:
+    vector<unique_ptr<WorkStealingDeque<PoolTask*>>> deques;
+    vector<thread> workers;
+    mutex injectLock;
+    deque<PoolTask*> injected;
+    atomic<bool> stopping;
+
+    static thread_local WorkStealingPool* currentPool;
+    static thread_local int currentIndex;
+
+    int self() const {
+        return currentPool == this ? currentIndex : -1;
+    }
+
+    bool findTask(PoolTask*& task) {
+        int me = self();
+        if (me >= 0 && deques[me]->pop(task)) return true;
+        thread_local mt19937 rng(hash<thread::id>()(this_thread::get_id()));
+        size_t n = deques.size(), start = rng() % n;
+        for (size_t k = 0; k < n; ++k) {
+            size_t victim = (start + k) % n;
+            if ((int)victim != me && deques[victim]->steal(task)) return true;
+        }
+        lock_guard<mutex> guard(injectLock);
+        if (injected.empty()) return false;
+        task = injected.front();
+        injected.pop_front();
+        return true;
+    }
+
+public:
+    WorkStealingPool(unsigned threads) : stopping(false) {
+        threads = max(1u, threads);
+        for (unsigned i = 0; i < threads; ++i) {
+            deques.emplace_back(new WorkStealingDeque<PoolTask*>());
+        }
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back([this, i] {
+                currentPool = this;
+                currentIndex = i;
+                PoolTask* task;
+                while (!stopping.load(memory_order_acquire)) {
+                    if (findTask(task)) {
+                        task->run();
+                    } else {
+                        this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+
+    // Callers must wait() on every group before the pool is destroyed
+    ~WorkStealingPool() {
+        stopping.store(true, memory_order_release);
+        for (thread& worker : workers) worker.join();
+    }
+
+    void spawn(TaskGroup& group, function<void()> fn) {
+        group.pending.fetch_add(1, memory_order_relaxed);
+        PoolTask* task = new PoolTask{move(fn), &group};
+        int me = self();
+        if (me >= 0) {
+            deques[me]->push(task);
+        } else {
+            lock_guard<mutex> guard(injectLock);
+            injected.push_back(task);
+        }
+    }
+
+    void wait(TaskGroup& group) {
+        PoolTask* task;
+        while (group.pending.load(memory_order_acquire) > 0) {
+            if (findTask(task)) {
+                task->run();
+            } else {
+                this_thread::yield();
+            }
+        }
+    }
+};
+
+thread_local WorkStealingPool* WorkStealingPool::currentPool = nullptr;
+thread_local int WorkStealingPool::currentIndex = -1;
+
+// Baseline: every task goes through one mutex-protected queue
+class SharedQueuePool {
+private:
+    vector<thread> workers;
+    mutex lock;
+    deque<PoolTask*> tasks;
+    atomic<bool> stopping;
+
+    bool findTask(PoolTask*& task) {
+        lock_guard<mutex> guard(lock);
+        if (tasks.empty()) return false;
+        task = tasks.front();
+        tasks.pop_front();
+        return true;
+    }
+
+public:
+    SharedQueuePool(unsigned threads) : stopping(false) {
+        for (unsigned i = 0; i < max(1u, threads); ++i) {
+            workers.emplace_back([this] {
+                PoolTask* task;
+                while (!stopping.load(memory_order_acquire)) {
+                    if (findTask(task)) {
+                        task->run();
+                    } else {
+                        this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+
+    ~SharedQueuePool() {
+        stopping.store(true, memory_order_release);
+        for (thread& worker : workers) worker.join();
+    }
+
+    void spawn(TaskGroup& group, function<void()> fn) {
+        group.pending.fetch_add(1, memory_order_relaxed);
+        lock_guard<mutex> guard(lock);
+        tasks.push_back(new PoolTask{move(fn), &group});
+    }
+
+    void wait(TaskGroup& group) {
+        PoolTask* task;
+        while (group.pending.load(memory_order_acquire) > 0) {
+            if (findTask(task)) {
+                task->run();
+            } else {
+                this_thread::yield();
+            }
+        }
+    }
+};
+
+// Recursive fork-join Fibonacci, sequential below the cutoff
+template <typename Pool>
+long long parallelFib(Pool& pool, int n, int cutoff) {
+    if (n < cutoff) {
+        return n < 2 ? n : parallelFib(pool, n - 1, cutoff) + parallelFib(pool, n - 2, cutoff);
+    }
+    long long left = 0;
+    TaskGroup group;
+    pool.spawn(group, [&] { left = parallelFib(pool, n - 1, cutoff); });
+    long long right = parallelFib(pool, n - 2, cutoff);
+    pool.wait(group);
+    return left + right;
+}
+
+void benchmarkForkJoin() {
+    unsigned threads = max(2u, thread::hardware_concurrency());
+    const int n = 30, cutoff = 14;
+    auto time = [&](auto& pool, const char* name) {
+        auto start = chrono::steady_clock::now();
+        long long result = parallelFib(pool, n, cutoff);
+        auto us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        cout << name << " x" << threads << ": fib(" << n << ") = " << result << " in " << us << " us\n";
+    };
+    {
+        SharedQueuePool shared(threads);
+        time(shared, "Shared queue pool");
+    }
+    {
+        WorkStealingPool stealing(threads);
+        time(stealing, "Work-stealing pool");
+    }
+}
+
+// Fixed-size Node Pool
+// Hands out equal-sized blocks carved from cache-line-aligned slabs. Freed
+// blocks go on an intrusive free list and are reused first; fresh slabs
+// are consumed with a bump pointer, so a new slab costs one allocation and
+// touches no memory up front. Not thread-safe: share one pool per thread,
+// e.g. via forThisThread().
+class NodePool {
+public:
+    struct Stats {
+        size_t allocations;   // blocks handed out
+        size_t deallocations; // blocks returned
+        size_t slabs;         // slabs obtained from the system
+    };
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    size_t blockSize, blocksPerSlab;
+    FreeBlock* freeList;
+    char *bumpCursor, *bumpEnd;
+    vector<void*> slabs;
+    Stats stats;
+
+public:
+    NodePool(size_t nodeSize, size_t blocksPerSlab = 1024)
+        : blocksPerSlab(blocksPerSlab), freeList(nullptr), bumpCursor(nullptr), bumpEnd(nullptr), stats{0, 0, 0} {
+        size_t align = alignof(max_align_t);
+        blockSize = (max(nodeSize, sizeof(FreeBlock)) + align - 1) / align * align;
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        for (void* slab : slabs) {
+            operator delete(slab, align_val_t(CACHE_LINE));
+        }
+    }
+
+    // Per-thread pool for a given node size, created on first use
+    static NodePool& forThisThread(size_t nodeSize) {
+        thread_local unordered_map<size_t, unique_ptr<NodePool>> pools;
+        unique_ptr<NodePool>& pool = pools[nodeSize];
+        if (!pool) pool.reset(new NodePool(nodeSize));
+        return *pool;
+    }
+
+    size_t nodeSize() const {
+        return blockSize;
+    }
+
+    void* allocate() {
+        stats.allocations++;
+        if (freeList) {
+            FreeBlock* block = freeList;
+            freeList = block->next;
+            return block;
+        }
+        if (bumpCursor == bumpEnd) {
+            void* slab = operator new(blockSize * blocksPerSlab, align_val_t(CACHE_LINE));
+            slabs.push_back(slab);
+            stats.slabs++;
+            bumpCursor = (char*)slab;
+            bumpEnd = bumpCursor + blockSize * blocksPerSlab;
+        }
+        void* block = bumpCursor;
+        bumpCursor += blockSize;
+        return block;
+    }
+
+    void deallocate(void* p) {
+        stats.deallocations++;
+        FreeBlock* block = (FreeBlock*)p;
+        block->next = freeList;
+        freeList = block;
+    }
+
+    Stats getStats() const {
+        return stats;
+    }
+};
+
 // Linked List-based Stack Implementation
 struct Node {
     int data;
@@ -62,14 +448,37 @@ struct Node {
 class LinkedListStack {
 private:
     Node* top;
+    NodePool* pool; // nullptr: plain new/delete
+
+    Node* createNode(int value, Node* next) {
+        return pool ? new (pool->allocate()) Node{value, next} : new Node{value, next};
+    }
+
+    void destroyNode(Node* node) {
+        if (pool) {
+            node->~Node();
+            pool->deallocate(node);
+        } else {
+            delete node;
+        }
+    }
 
 public:
-    LinkedListStack() {
+    LinkedListStack(NodePool* pool = nullptr) {
         top = nullptr;
+        this->pool = pool;
+        if (pool && pool->nodeSize() < nodeSize()) {
+            cout << "Pool blocks too small, using new/delete\n";
+            this->pool = nullptr;
+        }
+    }
+
+    static size_t nodeSize() {
+        return sizeof(Node);
     }
 
     void push(int value) {
-        Node* newNode = new Node{value, top};
+        Node* newNode = createNode(value, top);
         top = newNode;
     }
 
@@ -81,7 +490,7 @@ public:
             Node* temp = top;
             int value = temp->data;
             top = top->next;
-            delete temp;
+            destroyNode(temp);
             return value;
         }
     }
@@ -162,8 +571,250 @@ public:
     }
 };
 
+// Lock-free Single-Producer/Single-Consumer Ring Buffer
+// Capacity is rounded up to a power of two so wrap-around is a mask.
+// head is written only by the consumer and tail only by the producer,
+// published with release stores and read with acquire loads. Each side
+// also keeps a cached copy of the other's index on its own cache line and
+// only reloads it when the ring looks full/empty.
+template <typename T>
+class SpscQueue {
+private:
+    vector<T> buffer;
+    size_t mask;
+
+    alignas(CACHE_LINE) atomic<size_t> head; // next slot to read
+    alignas(CACHE_LINE) size_t cachedTail;   // consumer's view of tail
+    alignas(CACHE_LINE) atomic<size_t> tail; // next slot to write
+    alignas(CACHE_LINE) size_t cachedHead;   // producer's view of head
+
+public:
+    SpscQueue(size_t size) : head(0), cachedTail(0), tail(0), cachedHead(0) {
+        size_t capacity = 1;
+        while (capacity < size) capacity <<= 1;
+        buffer.resize(capacity);
+        mask = capacity - 1;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    // Producer side: copies up to n items, returns how many fit
+    size_t enqueueN(const T* items, size_t n) {
+        size_t t = tail.load(memory_order_relaxed);
+        size_t space = capacity() - (t - cachedHead);
+        if (space < n) {
+            cachedHead = head.load(memory_order_acquire);
+            space = capacity() - (t - cachedHead);
+        }
+        if (n > space) n = space;
+        for (size_t i = 0; i < n; ++i) {
+            buffer[(t + i) & mask] = items[i];
+        }
+        tail.store(t + n, memory_order_release);
+        return n;
+    }
+
+    // Consumer side: moves up to n items out, returns how many were ready
+    size_t dequeueN(T* items, size_t n) {
+        size_t h = head.load(memory_order_relaxed);
+        size_t ready = cachedTail - h;
+        if (ready < n) {
+            cachedTail = tail.load(memory_order_acquire);
+            ready = cachedTail - h;
+        }
+        if (n > ready) n = ready;
+        for (size_t i = 0; i < n; ++i) {
+            items[i] = move(buffer[(h + i) & mask]);
+        }
+        head.store(h + n, memory_order_release);
+        return n;
+    }
+
+    bool enqueue(const T& value) {
+        return enqueueN(&value, 1) == 1;
+    }
+
+    bool dequeue(T& value) {
+        return dequeueN(&value, 1) == 1;
+    }
+
+    // Approximate unless called from a quiescent state
+    bool isEmpty() const {
+        return head.load(memory_order_acquire) == tail.load(memory_order_acquire);
+    }
+};
+
+// SPSC throughput (batched transfer of many ints) and ping-pong latency
+void benchmarkSpscQueue() {
+    const size_t items = 10000000, batch = 64;
+    SpscQueue<int> queue(1 << 14);
+    auto start = chrono::steady_clock::now();
+    thread producer([&] {
+        int buf[batch];
+        for (size_t sent = 0; sent < items;) {
+            size_t n = min(batch, items - sent);
+            for (size_t i = 0; i < n; ++i) buf[i] = sent + i;
+            size_t done = 0;
+            while (done < n) {
+                size_t pushed = queue.enqueueN(buf + done, n - done);
+                if (!pushed) this_thread::yield();
+                done += pushed;
+            }
+            sent += n;
+        }
+    });
+    long long checksum = 0;
+    int buf[batch];
+    for (size_t received = 0; received < items;) {
+        size_t n = queue.dequeueN(buf, batch);
+        if (!n) this_thread::yield();
+        for (size_t i = 0; i < n; ++i) checksum += buf[i];
+        received += n;
+    }
+    producer.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Throughput: " << (long long)(items / seconds / 1e6) << " M items/s (checksum "
+         << checksum << ")\n";
+
+    const int rounds = 20000;
+    SpscQueue<int> ping(2), pong(2);
+    start = chrono::steady_clock::now();
+    thread echo([&] {
+        int value;
+        for (int i = 0; i < rounds; ++i) {
+            while (!ping.dequeue(value)) this_thread::yield();
+            while (!pong.enqueue(value)) this_thread::yield();
+        }
+    });
+    int value;
+    for (int i = 0; i < rounds; ++i) {
+        ping.enqueue(i);
+        while (!pong.dequeue(value)) this_thread::yield();
+    }
+    echo.join();
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    cout << "Round-trip latency: " << (long long)(ns / rounds) << " ns\n";
+}
+
+// Unrolled Queue
+// A linked queue whose nodes each hold a cache line's worth of elements
+// (at least 16, so large element types still amortize the link), consumed
+// from head and filled at tail within the block.
+// One pointer per block instead of per element, and dequeues walk memory
+// sequentially. Emptied blocks go on a free list for reuse.
+template <typename T>
+class UnrolledQueue {
+private:
+    static constexpr size_t BLOCK_ITEMS = CACHE_LINE / sizeof(T) > 16 ? CACHE_LINE / sizeof(T) : 16;
+
+    struct Block {
+        alignas(CACHE_LINE) T items[BLOCK_ITEMS];
+        size_t head, tail; // live items are [head, tail)
+        Block* next;
+    };
+
+    Block *front, *rear, *freeBlocks;
+    size_t count;
+
+    Block* newBlock() {
+        Block* block = freeBlocks;
+        if (block) {
+            freeBlocks = block->next;
+        } else {
+            block = new Block;
+        }
+        block->head = block->tail = 0;
+        block->next = nullptr;
+        return block;
+    }
+
+public:
+    UnrolledQueue() : front(nullptr), rear(nullptr), freeBlocks(nullptr), count(0) {}
+
+    UnrolledQueue(const UnrolledQueue&) = delete;
+    UnrolledQueue& operator=(const UnrolledQueue&) = delete;
+
+    ~UnrolledQueue() {
+        Block* lists[] = {front, freeBlocks};
+        for (Block* block : lists) {
+            while (block) {
+                Block* next = block->next;
+                delete block;
+                block = next;
+            }
+        }
+    }
+
+    void enqueue(T value) {
+        if (!rear || rear->tail == BLOCK_ITEMS) {
+            Block* block = newBlock();
+            if (rear) {
+                rear->next = block;
+            } else {
+                front = block;
+            }
+            rear = block;
+        }
+        rear->items[rear->tail++] = move(value);
+        count++;
+    }
+
+    bool dequeue(T& value) {
+        if (count == 0) return false;
+        value = move(front->items[front->head++]);
+        count--;
+        if (front->head == front->tail) {
+            Block* empty = front;
+            front = front->next;
+            if (!front) rear = nullptr;
+            empty->next = freeBlocks;
+            freeBlocks = empty;
+        }
+        return true;
+    }
+
+    T& peek() {
+        return front->items[front->head];
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    // Visits elements front to back without removing them
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (const Block* block = front; block; block = block->next) {
+            for (size_t i = block->head; i < block->tail; ++i) visit(block->items[i]);
+        }
+    }
+
+    // Removes every element, front to back, handing each to sink
+    template <typename Sink>
+    void drain(Sink sink) {
+        while (front) {
+            for (size_t i = front->head; i < front->tail; ++i) sink(move(front->items[i]));
+            Block* empty = front;
+            front = front->next;
+            empty->next = freeBlocks;
+            freeBlocks = empty;
+        }
+        rear = nullptr;
+        count = 0;
+    }
+};
+
 // Linked List-based Queue Implementation
 class LinkedListQueue {
+public:
+    enum Storage { NODES, UNROLLED };
+
 private:
     struct Node {
         int data;
@@ -171,14 +822,50 @@ private:
     };
 
     Node *front, *rear;
+    NodePool* pool; // nullptr: plain new/delete
+    Storage storage;
+    UnrolledQueue<int> blocks; // used in UNROLLED mode
+
+    Node* createNode(int value) {
+        return pool ? new (pool->allocate()) Node{value, nullptr} : new Node{value, nullptr};
+    }
+
+    void destroyNode(Node* node) {
+        if (pool) {
+            node->~Node();
+            pool->deallocate(node);
+        } else {
+            delete node;
+        }
+    }
 
 public:
-    LinkedListQueue() {
+    LinkedListQueue(Storage storage) {
+        front = rear = nullptr;
+        pool = nullptr;
+        this->storage = storage;
+    }
+
+    LinkedListQueue(NodePool* pool = nullptr) {
         front = rear = nullptr;
+        storage = NODES;
+        this->pool = pool;
+        if (pool && pool->nodeSize() < nodeSize()) {
+            cout << "Pool blocks too small, using new/delete\n";
+            this->pool = nullptr;
+        }
+    }
+
+    static size_t nodeSize() {
+        return sizeof(Node);
     }
 
     void enqueue(int value) {
-        Node* newNode = new Node{value, nullptr};
+        if (storage == UNROLLED) {
+            blocks.enqueue(value);
+            return;
+        }
+        Node* newNode = createNode(value);
         if (rear == nullptr) {
             front = rear = newNode;
         } else {
@@ -191,12 +878,16 @@ public:
         if (isEmpty()) {
             cout << "Queue Underflow\n";
             return -1;
+        } else if (storage == UNROLLED) {
+            int value;
+            blocks.dequeue(value);
+            return value;
         } else {
             Node* temp = front;
             int value = temp->data;
             front = front->next;
             if (front == nullptr) rear = nullptr;
-            delete temp;
+            destroyNode(temp);
             return value;
         }
     }
@@ -206,12 +897,12 @@ public:
             cout << "Queue is empty\n";
             return -1;
         } else {
-            return front->data;
+            return storage == UNROLLED ? blocks.peek() : front->data;
         }
     }
 
     bool isEmpty() {
-        return front == nullptr;
+        return storage == UNROLLED ? blocks.isEmpty() : front == nullptr;
     }
 
     ~LinkedListQueue() {
@@ -221,21 +912,378 @@ public:
     }
 };
 
-// Reverse a String Using Stack
-string reverseString(const string& str) {
-    stack<char> s;
-    for (char c : str) {
-        s.push(c);
+// Fill, traverse and drain: node-per-element LinkedListQueue vs
+// UnrolledQueue<int>, and TicketQueue's std::deque<string> vs UnrolledQueue<string>
+void benchmarkUnrolledQueue() {
+    const int n = 2000000;
+    auto us = [](chrono::steady_clock::time_point since) {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - since).count();
+    };
+
+    auto start = chrono::steady_clock::now();
+    LinkedListQueue nodes;
+    for (int i = 0; i < n; ++i) nodes.enqueue(i);
+    long long fillNodes = us(start);
+    start = chrono::steady_clock::now();
+    long long sum = 0;
+    while (!nodes.isEmpty()) sum += nodes.dequeue();
+    long long drainNodes = us(start);
+
+    start = chrono::steady_clock::now();
+    UnrolledQueue<int> unrolled;
+    for (int i = 0; i < n; ++i) unrolled.enqueue(i);
+    long long fillUnrolled = us(start);
+    start = chrono::steady_clock::now();
+    long long traversed = 0;
+    unrolled.forEach([&](int value) { traversed += value; });
+    long long traverseUnrolled = us(start);
+    start = chrono::steady_clock::now();
+    long long drained = 0;
+    unrolled.drain([&](int value) { drained += value; });
+    long long drainUnrolled = us(start);
+    cout << "int x" << n << ": LinkedListQueue fill " << fillNodes << " us, drain " << drainNodes
+         << " us | unrolled fill " << fillUnrolled << " us, traverse " << traverseUnrolled << " us, drain "
+         << drainUnrolled << " us" << (sum == drained && sum == traversed ? "" : " MISMATCH") << endl;
+
+    const int tickets = 500000;
+    start = chrono::steady_clock::now();
+    deque<string> ticketDeque;
+    for (int i = 0; i < tickets; ++i) ticketDeque.push_back("ticket" + to_string(i));
+    size_t dequeBytes = 0;
+    for (const string& t : ticketDeque) dequeBytes += t.size();
+    while (!ticketDeque.empty()) {
+        string t = move(ticketDeque.front());
+        ticketDeque.pop_front();
+    }
+    long long dequeTime = us(start);
+    start = chrono::steady_clock::now();
+    UnrolledQueue<string> ticketBlocks;
+    for (int i = 0; i < tickets; ++i) ticketBlocks.enqueue("ticket" + to_string(i));
+    size_t blockBytes = 0;
+    ticketBlocks.forEach([&](const string& t) { blockBytes += t.size(); });
+    ticketBlocks.drain([](string) {});
+    long long blockTime = us(start);
+    cout << "string x" << tickets << " fill+traverse+drain: std::deque " << dequeTime << " us, unrolled "
+         << blockTime << " us" << (dequeBytes == blockBytes ? "" : " MISMATCH") << endl;
+}
+
+// Lock-free Multi-Producer/Multi-Consumer Queue (Michael-Scott)
+// The LinkedListQueue layout with a dummy head node and CAS on head/tail.
+// Each thread works through a Handle that owns one hazard-pointer slot:
+// a node is only recycled once no slot points at it, which also rules out
+// ABA on the CASes. Freed nodes go to the handle's local free list and are
+// exchanged with a shared pool in batches, so steady state does no new/delete.
+template <typename T>
+class MpmcQueue {
+private:
+    struct Node {
+        T value;
+        atomic<Node*> next;
+    };
+
+    struct alignas(CACHE_LINE) HazardSlot {
+        atomic<Node*> hazard[2];
+        atomic<bool> inUse;
+    };
+
+    static constexpr int MAX_THREADS = 128;
+    static constexpr size_t SCAN_THRESHOLD = 2 * 2 * MAX_THREADS;
+    static constexpr size_t POOL_BATCH = 256;
+
+    alignas(CACHE_LINE) atomic<Node*> head;
+    alignas(CACHE_LINE) atomic<Node*> tail;
+    HazardSlot slots[MAX_THREADS];
+
+    mutex poolLock;
+    vector<Node*> sharedPool; // free nodes handed between threads
+    vector<Node*> orphans;    // retired by handles that went away
+    atomic<size_t> allocatedNodes;
+
+public:
+    class Handle {
+    private:
+        friend class MpmcQueue;
+        MpmcQueue* queue;
+        int slot;
+        vector<Node*> retired, freeNodes;
+
+        Handle(MpmcQueue* queue, int slot) : queue(queue), slot(slot) {}
+
+    public:
+        Handle(Handle&& other) : queue(other.queue), slot(other.slot), retired(move(other.retired)),
+                                 freeNodes(move(other.freeNodes)) {
+            other.queue = nullptr;
+        }
+
+        // Retired nodes that are already safe go back to the shared pool;
+        // only those another thread still protects are left as orphans
+        ~Handle() {
+            if (!queue) return;
+            queue->reclaim(retired, freeNodes);
+            lock_guard<mutex> guard(queue->poolLock);
+            queue->orphans.insert(queue->orphans.end(), retired.begin(), retired.end());
+            queue->sharedPool.insert(queue->sharedPool.end(), freeNodes.begin(), freeNodes.end());
+            queue->slots[slot].inUse.store(false, memory_order_release);
+        }
+    };
+
+private:
+    Node* protect(const atomic<Node*>& source, Handle& h, int index) {
+        Node* p = source.load(memory_order_acquire);
+        while (true) {
+            slots[h.slot].hazard[index].store(p, memory_order_seq_cst);
+            Node* again = source.load(memory_order_acquire);
+            if (again == p) return p;
+            p = again;
+        }
+    }
+
+    void clearHazards(Handle& h) {
+        slots[h.slot].hazard[0].store(nullptr, memory_order_release);
+        slots[h.slot].hazard[1].store(nullptr, memory_order_release);
+    }
+
+    Node* allocate(Handle& h) {
+        if (h.freeNodes.empty()) {
+            lock_guard<mutex> guard(poolLock);
+            size_t take = min(POOL_BATCH, sharedPool.size());
+            h.freeNodes.insert(h.freeNodes.end(), sharedPool.end() - take, sharedPool.end());
+            sharedPool.resize(sharedPool.size() - take);
+        }
+        if (h.freeNodes.empty()) {
+            allocatedNodes++;
+            return new Node{T(), {nullptr}};
+        }
+        Node* node = h.freeNodes.back();
+        h.freeNodes.pop_back();
+        return node;
+    }
+
+    // Moves nodes in retired that no hazard slot references to freed
+    void reclaim(vector<Node*>& retired, vector<Node*>& freed) {
+        vector<Node*> hazards;
+        for (HazardSlot& s : slots) {
+            for (atomic<Node*>& hp : s.hazard) {
+                Node* p = hp.load(memory_order_seq_cst);
+                if (p) hazards.push_back(p);
+            }
+        }
+        sort(hazards.begin(), hazards.end());
+        size_t kept = 0;
+        for (Node* n : retired) {
+            if (binary_search(hazards.begin(), hazards.end(), n)) {
+                retired[kept++] = n;
+            } else {
+                freed.push_back(n);
+            }
+        }
+        retired.resize(kept);
+    }
+
+    // Every SCAN_THRESHOLD retires, adopts the orphans of departed handles
+    // and recycles whatever is no longer protected
+    void retire(Handle& h, Node* node) {
+        h.retired.push_back(node);
+        if (h.retired.size() < SCAN_THRESHOLD) return;
+        {
+            lock_guard<mutex> guard(poolLock);
+            h.retired.insert(h.retired.end(), orphans.begin(), orphans.end());
+            orphans.clear();
+        }
+        reclaim(h.retired, h.freeNodes);
+        if (h.freeNodes.size() > 2 * POOL_BATCH) {
+            lock_guard<mutex> guard(poolLock);
+            sharedPool.insert(sharedPool.end(), h.freeNodes.end() - POOL_BATCH, h.freeNodes.end());
+            h.freeNodes.resize(h.freeNodes.size() - POOL_BATCH);
+        }
+    }
+
+public:
+    MpmcQueue() : allocatedNodes(1) {
+        Node* dummy = new Node{T(), {nullptr}};
+        head.store(dummy);
+        tail.store(dummy);
+        for (HazardSlot& s : slots) {
+            s.hazard[0].store(nullptr);
+            s.hazard[1].store(nullptr);
+            s.inUse.store(false);
+        }
+    }
+
+    // All handles must be destroyed before the queue
+    ~MpmcQueue() {
+        for (Node* node = head.load(); node;) {
+            Node* next = node->next.load();
+            delete node;
+            node = next;
+        }
+        for (Node* node : sharedPool) delete node;
+        for (Node* node : orphans) delete node;
+    }
+
+    // Claims a hazard slot for the calling thread; waits if all are taken
+    Handle registerThread() {
+        while (true) {
+            for (int i = 0; i < MAX_THREADS; ++i) {
+                bool expected = false;
+                if (slots[i].inUse.compare_exchange_strong(expected, true, memory_order_acquire)) {
+                    return Handle(this, i);
+                }
+            }
+            this_thread::yield();
+        }
+    }
+
+    void enqueue(Handle& h, T value) {
+        Node* node = allocate(h);
+        node->value = move(value);
+        node->next.store(nullptr, memory_order_relaxed);
+        while (true) {
+            Node* last = protect(tail, h, 0);
+            Node* next = last->next.load(memory_order_acquire);
+            if (last != tail.load(memory_order_acquire)) continue;
+            if (next == nullptr) {
+                if (last->next.compare_exchange_weak(next, node, memory_order_release, memory_order_relaxed)) {
+                    tail.compare_exchange_strong(last, node, memory_order_release, memory_order_relaxed);
+                    break;
+                }
+            } else {
+                tail.compare_exchange_strong(last, next, memory_order_release, memory_order_relaxed);
+            }
+        }
+        clearHazards(h);
     }
 
-    string reversed = "";
-    while (!s.empty()) {
-        reversed += s.top();
-        s.pop();
+    bool dequeue(Handle& h, T& value) {
+        while (true) {
+            Node* first = protect(head, h, 0);
+            Node* last = tail.load(memory_order_acquire);
+            Node* next = protect(first->next, h, 1);
+            if (first != head.load(memory_order_acquire)) continue;
+            if (next == nullptr) {
+                clearHazards(h);
+                return false;
+            }
+            if (first == last) {
+                tail.compare_exchange_strong(last, next, memory_order_release, memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_strong(first, next, memory_order_acq_rel, memory_order_relaxed)) {
+                value = move(next->value); // next is the new dummy, protected by hazard[1]
+                clearHazards(h);
+                retire(h, first);
+                return true;
+            }
+        }
+    }
+
+    // Nodes ever obtained from new; stays flat once the pool is warm
+    size_t allocated() const {
+        return allocatedNodes.load();
+    }
+};
+
+// String Reversal
+// Blocks are reversed in registers: 32 bytes via an in-lane byte shuffle
+// plus a lane swap with AVX2, otherwise 8 bytes via bswap. The in-place
+// version works inward from both ends, swapping reversed blocks.
+#ifdef __AVX2__
+static inline __m256i reverse32(__m256i v) {
+    const __m256i mask = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, mask), 0x4E);
+}
+#endif
+
+void reverseInPlace(string& str) {
+    char* lo = &str[0];
+    char* hi = lo + str.size(); // one past the last unswapped byte
+#ifdef __AVX2__
+    while (hi - lo >= 64) {
+        __m256i front = _mm256_loadu_si256((const __m256i*)lo);
+        __m256i back = _mm256_loadu_si256((const __m256i*)(hi - 32));
+        _mm256_storeu_si256((__m256i*)lo, reverse32(back));
+        _mm256_storeu_si256((__m256i*)(hi - 32), reverse32(front));
+        lo += 32;
+        hi -= 32;
+    }
+#endif
+    while (hi - lo >= 16) {
+        uint64_t front, back;
+        memcpy(&front, lo, 8);
+        memcpy(&back, hi - 8, 8);
+        front = __builtin_bswap64(front);
+        back = __builtin_bswap64(back);
+        memcpy(lo, &back, 8);
+        memcpy(hi - 8, &front, 8);
+        lo += 8;
+        hi -= 8;
+    }
+    while (hi - lo >= 2) {
+        swap(*lo++, *--hi);
+    }
+}
+
+string reverseCopy(const string& str) {
+    size_t n = str.size(), i = 0;
+    string reversed(n, '\0');
+    const char* src = str.data();
+    char* dst = &reversed[0];
+#ifdef __AVX2__
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + n - i - 32), reverse32(v));
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+        uint64_t word;
+        memcpy(&word, src + i, 8);
+        word = __builtin_bswap64(word);
+        memcpy(dst + n - i - 8, &word, 8);
+    }
+    for (; i < n; ++i) {
+        dst[n - 1 - i] = src[i];
     }
     return reversed;
 }
 
+// Reverses code points rather than bytes: after a byte reversal every
+// multibyte sequence reads continuation bytes first and its lead byte
+// last, so each such run is flipped back. ASCII is skipped 8 bytes at a
+// time. The lead byte says how many continuation bytes (1 to 3) belong to
+// it; any extra ones, and runs with no lead byte, are left as bytes.
+string reverseUtf8(const string& str) {
+    string reversed = reverseCopy(str);
+    size_t n = reversed.size(), i = 0;
+    while (i < n) {
+        uint64_t word;
+        if (i + 8 <= n && (memcpy(&word, &reversed[i], 8), (word & 0x8080808080808080ULL) == 0)) {
+            i += 8;
+            continue;
+        }
+        unsigned char c = reversed[i];
+        if ((c & 0xC0) != 0x80) {
+            ++i;
+            continue;
+        }
+        size_t end = i;
+        while (end < n && ((unsigned char)reversed[end] & 0xC0) == 0x80) ++end;
+        if (end == n) break;
+        unsigned char lead = reversed[end];
+        size_t trail = (lead & 0xE0) == 0xC0 ? 1 : (lead & 0xF0) == 0xE0 ? 2 : (lead & 0xF8) == 0xF0 ? 3 : 0;
+        if (trail != 0 && trail <= end - i) {
+            reverse(reversed.begin() + (end - trail), reversed.begin() + end + 1);
+        }
+        i = end + 1;
+    }
+    return reversed;
+}
+
+// Reverse a String (formerly via stack<char>; now a block reversal)
+string reverseString(const string& str) {
+    return reverseCopy(str);
+}
+
 // Print Queue Simulation
 class PrintQueue {
 private:
@@ -256,6 +1304,143 @@ public:
     }
 };
 
+// Log2-bucketed latency histogram: bucket i counts samples in [2^i, 2^(i+1)) ns
+class LatencyHistogram {
+public:
+    static constexpr int BUCKETS = 40;
+
+private:
+    atomic<uint64_t> buckets[BUCKETS];
+
+public:
+    LatencyHistogram() {
+        for (atomic<uint64_t>& b : buckets) b.store(0);
+    }
+
+    void record(uint64_t nanos) {
+        int bucket = nanos ? 63 - __builtin_clzll(nanos) : 0;
+        buckets[min(bucket, BUCKETS - 1)].fetch_add(1, memory_order_relaxed);
+    }
+
+    uint64_t count(int bucket) const {
+        return buckets[bucket].load(memory_order_relaxed);
+    }
+
+    // Upper bound (ns) of the bucket holding the given percentile
+    uint64_t percentile(double p) const {
+        uint64_t total = 0;
+        for (int i = 0; i < BUCKETS; ++i) total += count(i);
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            seen += count(i);
+            if (total && seen >= p / 100.0 * total) return uint64_t(2) << i;
+        }
+        return 0;
+    }
+};
+
+// Asynchronous Print Queue
+// Producers add documents to a bounded queue and block while it is full
+// (backpressure). Worker threads take up to batchSize documents per lock
+// acquisition and hand each to the printer. Documents are moved, never
+// copied. Queue wait and service time are recorded per document.
+class AsyncPrintQueue {
+private:
+    using Clock = chrono::steady_clock;
+
+    struct Job {
+        string doc;
+        Clock::time_point enqueued;
+    };
+
+    size_t capacity, batchSize;
+    function<void(const string&)> printer;
+    mutex lock;
+    condition_variable notEmpty, notFull;
+    deque<Job> jobs;
+    bool closed;
+    vector<thread> workers;
+    LatencyHistogram waitTimes, serviceTimes;
+
+    void workerLoop() {
+        vector<Job> batch;
+        while (true) {
+            {
+                unique_lock<mutex> guard(lock);
+                notEmpty.wait(guard, [this] { return closed || !jobs.empty(); });
+                if (jobs.empty()) return; // closed and drained
+                size_t n = min(batchSize, jobs.size());
+                for (size_t i = 0; i < n; ++i) {
+                    batch.push_back(move(jobs.front()));
+                    jobs.pop_front();
+                }
+            }
+            notFull.notify_all();
+            for (Job& job : batch) {
+                Clock::time_point start = Clock::now();
+                waitTimes.record(chrono::duration_cast<chrono::nanoseconds>(start - job.enqueued).count());
+                printer(job.doc);
+                serviceTimes.record(chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start).count());
+            }
+            batch.clear();
+        }
+    }
+
+public:
+    AsyncPrintQueue(unsigned threads, size_t capacity, size_t batchSize, function<void(const string&)> printer)
+        : capacity(max<size_t>(1, capacity)), batchSize(max<size_t>(1, batchSize)), printer(move(printer)), closed(false) {
+        for (unsigned i = 0; i < max(1u, threads); ++i) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~AsyncPrintQueue() {
+        close();
+    }
+
+    // Blocks while the queue is full; returns false once closed
+    bool addDocument(string doc) {
+        unique_lock<mutex> guard(lock);
+        notFull.wait(guard, [this] { return closed || jobs.size() < capacity; });
+        if (closed) return false;
+        jobs.push_back({move(doc), Clock::now()});
+        guard.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // Non-blocking variant: false if full or closed
+    bool tryAddDocument(string& doc) {
+        unique_lock<mutex> guard(lock);
+        if (closed || jobs.size() >= capacity) return false;
+        jobs.push_back({move(doc), Clock::now()});
+        guard.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // Stops accepting documents, prints what is queued, joins the workers
+    void close() {
+        {
+            lock_guard<mutex> guard(lock);
+            closed = true;
+        }
+        notEmpty.notify_all();
+        notFull.notify_all();
+        for (thread& worker : workers) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    const LatencyHistogram& queueWaitHistogram() const {
+        return waitTimes;
+    }
+
+    const LatencyHistogram& serviceTimeHistogram() const {
+        return serviceTimes;
+    }
+};
+
 // Main Function
 int main() {
     // Array-based Stack Example
@@ -266,6 +1451,46 @@ int main() {
     cout << "Top of Stack: " << arrayStack.peek() << endl;
     cout << "Popped: " << arrayStack.pop() << endl;
 
+    // Pooled Linked Containers Example
+    cout << "\nNode Pool Example:\n";
+    NodePool stackPool(LinkedListStack::nodeSize());
+    {
+        LinkedListStack pooledStack(&stackPool);
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 1000; ++i) pooledStack.push(i);
+            while (!pooledStack.isEmpty()) pooledStack.pop();
+        }
+    }
+    NodePool::Stats stats = stackPool.getStats();
+    cout << "Stack pool: " << stats.allocations << " allocations, " << stats.deallocations
+         << " deallocations, " << stats.slabs << " slab(s)\n";
+    LinkedListQueue pooledQueue(&NodePool::forThisThread(LinkedListQueue::nodeSize()));
+    pooledQueue.enqueue(7);
+    pooledQueue.enqueue(8);
+    cout << "Pooled queue dequeued: " << pooledQueue.dequeue() << endl;
+
+    // SPSC Ring Buffer Example
+    cout << "\nSPSC Queue Example:\n";
+    SpscQueue<int> spsc(3);
+    int batchIn[] = {1, 2, 3, 4, 5};
+    cout << "Capacity: " << spsc.capacity() << ", accepted: " << spsc.enqueueN(batchIn, 5) << endl;
+    int batchOut[5];
+    size_t got = spsc.dequeueN(batchOut, 5);
+    cout << "Dequeued:";
+    for (size_t i = 0; i < got; ++i) cout << " " << batchOut[i];
+    cout << endl;
+    benchmarkSpscQueue();
+
+    // Work-Stealing Example
+    cout << "\nWork-Stealing Deque Example:\n";
+    WorkStealingDeque<int> wsDeque(2);
+    for (int i = 1; i <= 5; ++i) wsDeque.push(i);
+    int stolen = -1, popped = -1;
+    wsDeque.steal(stolen);
+    wsDeque.pop(popped);
+    cout << "Stolen from top: " << stolen << ", popped from bottom: " << popped << endl;
+    benchmarkForkJoin();
+
     // Linked List-based Queue Example
     cout << "\nLinked List Queue Example:\n";
     LinkedListQueue linkedQueue;
@@ -274,10 +1499,53 @@ int main() {
     cout << "Front of Queue: " << linkedQueue.peek() << endl;
     cout << "Dequeued: " << linkedQueue.dequeue() << endl;
 
+    LinkedListQueue unrolledQueue(LinkedListQueue::UNROLLED);
+    for (int i = 1; i <= 20; ++i) unrolledQueue.enqueue(i * 10);
+    cout << "Unrolled queue dequeued: " << unrolledQueue.dequeue() << ", next: " << unrolledQueue.peek() << endl;
+    benchmarkUnrolledQueue();
+
+    // MPMC Queue Example
+    cout << "\nMPMC Queue Example:\n";
+    MpmcQueue<int> mpmc;
+    const int producers = 4, consumers = 2, perProducer = 100000;
+    atomic<long long> consumedSum(0);
+    atomic<int> consumedCount(0);
+    vector<thread> workers;
+    for (int p = 0; p < producers; ++p) {
+        workers.emplace_back([&] {
+            auto handle = mpmc.registerThread();
+            for (int i = 1; i <= perProducer; ++i) mpmc.enqueue(handle, i);
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        workers.emplace_back([&] {
+            auto handle = mpmc.registerThread();
+            int value;
+            while (consumedCount.load() < producers * perProducer) {
+                if (mpmc.dequeue(handle, value)) {
+                    consumedSum += value;
+                    consumedCount++;
+                } else {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+    for (thread& worker : workers) worker.join();
+    cout << "Consumed " << consumedCount.load() << " items, sum " << consumedSum.load()
+         << ", nodes allocated: " << mpmc.allocated() << endl;
+
     // Reverse String Example
     cout << "\nReversing String:\n";
     string input = "hello";
     cout << "Reversed: " << reverseString(input) << endl;
+    string inPlace = "abcdefghijklmnopqrstuvwxyz";
+    reverseInPlace(inPlace);
+    cout << "Reversed in place: " << inPlace << endl;
+    cout << "UTF-8 reversed: " << reverseUtf8("na\u00efve caf\u00e9 \u20ac5") << endl;
+    // F0 takes exactly three continuation bytes, so the fourth stays a stray byte
+    cout << "Overlong continuation run: "
+         << (reverseUtf8("\xF0\x9F\x98\x80\x80!") == "!\x80\xF0\x9F\x98\x80" ? "ok" : "FAILED") << endl;
 
     // Print Queue Example
     cout << "\nPrint Queue Simulation:\n";
@@ -287,5 +1555,17 @@ int main() {
     printQueue.processDocument();
     printQueue.processDocument();
 
+    // Asynchronous Print Queue Example
+    cout << "\nAsync Print Queue:\n";
+    atomic<int> printed(0);
+    AsyncPrintQueue asyncQueue(2, 16, 4, [&](const string& doc) { printed += doc.size() > 0; });
+    for (int i = 0; i < 1000; ++i) {
+        asyncQueue.addDocument("doc" + to_string(i));
+    }
+    asyncQueue.close();
+    cout << "Printed " << printed.load() << " documents, p50 wait <= "
+         << asyncQueue.queueWaitHistogram().percentile(50) << " ns, p99 service <= "
+         << asyncQueue.serviceTimeHistogram().percentile(99) << " ns\n";
+
     return 0;
 }
@@ -3,9 +3,177 @@
 #include <deque>
 #include <queue>
 #include <sstream>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <new>
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 using namespace std;
 
+const size_t CACHE_LINE = 64;
+
+// Per-list Node Arena
+// Nodes come from geometrically growing chunks owned by the list, and
+// freed nodes are threaded onto a free list for reuse. Everything is
+// released together when the arena goes away. compact() support:
+// allocateRun(n) returns n adjacent slots as their own chunk, and adopt()
+// takes over another arena's chunks (used to swap in a relocated copy).
+// Node must be trivially destructible.
+template <typename Node>
+class NodeArena {
+private:
+    union Slot {
+        Slot* nextFree;
+        alignas(Node) unsigned char bytes[sizeof(Node)];
+    };
+
+    vector<Slot*> chunks;
+    Slot* freeList;
+    Slot *bumpCursor, *bumpEnd;
+    size_t nextChunk;
+
+    Slot* newChunk(size_t n) {
+        Slot* chunk = static_cast<Slot*>(operator new(n * sizeof(Slot)));
+        chunks.push_back(chunk);
+        return chunk;
+    }
+
+public:
+    NodeArena() : freeList(nullptr), bumpCursor(nullptr), bumpEnd(nullptr), nextChunk(64) {}
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    ~NodeArena() {
+        for (Slot* chunk : chunks) operator delete(chunk);
+    }
+
+    template <typename... Args>
+    Node* create(Args... args) {
+        Slot* slot = freeList;
+        if (slot) {
+            freeList = slot->nextFree;
+        } else {
+            if (bumpCursor == bumpEnd) {
+                bumpCursor = newChunk(nextChunk);
+                bumpEnd = bumpCursor + nextChunk;
+                nextChunk = min<size_t>(nextChunk * 2, 65536);
+            }
+            slot = bumpCursor++;
+        }
+        return new (slot) Node(args...);
+    }
+
+    void destroy(Node* node) {
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+
+    // n uninitialized, adjacent node slots
+    Node* allocateRun(size_t n) {
+        return reinterpret_cast<Node*>(newChunk(max<size_t>(n, 1)));
+    }
+
+    // Frees this arena's memory and takes ownership of other's
+    void adopt(NodeArena& other) {
+        for (Slot* chunk : chunks) operator delete(chunk);
+        chunks.swap(other.chunks);
+        other.chunks.clear();
+        freeList = other.freeList;
+        bumpCursor = other.bumpCursor;
+        bumpEnd = other.bumpEnd;
+        nextChunk = other.nextChunk;
+        other.freeList = other.bumpCursor = other.bumpEnd = nullptr;
+    }
+};
+
+// Value Index
+// Hash index from each value to a chain of its nodes in list order. The
+// chain links (and, for singly linked lists, each node's predecessor)
+// live in a side table keyed by node, so unindexed lists pay nothing for
+// them. append, erase, first and pred are all O(1) expected.
+template <typename Node>
+class ValueIndex {
+    struct Links {
+        Node* pred;
+        Node* samePrev;
+        Node* sameNext;
+    };
+
+    struct Chain {
+        Node* first;
+        Node* last;
+    };
+
+    unordered_map<int, Chain> chains;
+    unordered_map<Node*, Links> links;
+
+public:
+    void append(Node* node, Node* pred = nullptr) {
+        Links& l = links[node];
+        l = Links{pred, nullptr, nullptr};
+        auto it = chains.find(node->data);
+        if (it == chains.end()) {
+            chains.emplace(node->data, Chain{node, node});
+        } else {
+            l.samePrev = it->second.last;
+            links[l.samePrev].sameNext = node;
+            it->second.last = node;
+        }
+    }
+
+    void erase(Node* node) {
+        auto self = links.find(node);
+        Node* samePrev = self->second.samePrev;
+        Node* sameNext = self->second.sameNext;
+        links.erase(self);
+        if (samePrev) links[samePrev].sameNext = sameNext;
+        if (sameNext) links[sameNext].samePrev = samePrev;
+        if (samePrev && sameNext) return;
+        auto it = chains.find(node->data);
+        if (samePrev) {
+            it->second.last = samePrev;
+        } else if (sameNext) {
+            it->second.first = sameNext;
+        } else {
+            chains.erase(it);
+        }
+    }
+
+    Node* first(int value) const {
+        auto it = chains.find(value);
+        return it == chains.end() ? nullptr : it->second.first;
+    }
+
+    // Predecessor recorded for node (nullptr = head)
+    Node*& pred(Node* node) {
+        return links[node].pred;
+    }
+
+    void clear() {
+        chains.clear();
+        links.clear();
+    }
+};
+
 // Singly Linked List
+// Keeps a tail pointer so insert is O(1). With `indexed`, each node also
+// has its predecessor recorded and a ValueIndex finds the first node
+// holding a value, so remove(data) is O(1) expected.
+// Handles returned by insert stay valid until that node is removed or the
+// list is compacted.
 class SinglyLinkedList {
     struct Node {
         int data;
@@ -14,29 +182,54 @@ class SinglyLinkedList {
     };
 
     Node* head;
+    Node* tail;
+    bool indexed;
+    ValueIndex<Node> index;
+    NodeArena<Node> arena;
+
+    // Unlinks and frees the node after prev (the head if prev is nullptr)
+    void unlinkAfter(Node* prev) {
+        Node* node = prev ? prev->next : head;
+        Node* next = node->next;
+        if (prev) {
+            prev->next = next;
+        } else {
+            head = next;
+        }
+        if (tail == node) tail = prev;
+        if (indexed) {
+            index.erase(node);
+            if (next) index.pred(next) = prev;
+        }
+        arena.destroy(node);
+    }
 
 public:
-    SinglyLinkedList() : head(nullptr) {}
+    using Handle = Node*;
 
-    void insert(int data) {
-        Node* new_node = new Node(data);
+    SinglyLinkedList(bool indexed = false) : head(nullptr), tail(nullptr), indexed(indexed) {}
+
+    Handle insert(int data) {
+        Node* new_node = arena.create(data);
+        if (indexed) index.append(new_node, tail);
         if (!head) {
             head = new_node;
         } else {
-            Node* current = head;
-            while (current->next) {
-                current = current->next;
-            }
-            current->next = new_node;
+            tail->next = new_node;
         }
+        tail = new_node;
+        return new_node;
     }
 
     void remove(int data) {
+        if (indexed) {
+            Node* node = index.first(data);
+            if (node) unlinkAfter(index.pred(node));
+            return;
+        }
         if (!head) return;
         if (head->data == data) {
-            Node* temp = head;
-            head = head->next;
-            delete temp;
+            unlinkAfter(nullptr);
             return;
         }
         Node* current = head;
@@ -44,9 +237,48 @@ public:
             current = current->next;
         }
         if (current->next) {
-            Node* temp = current->next;
-            current->next = current->next->next;
-            delete temp;
+            unlinkAfter(current);
+        }
+    }
+
+    // Removes the node following prev; nullptr removes the head
+    void removeAfter(Handle prev) {
+        if (prev ? prev->next : head) unlinkAfter(prev);
+    }
+
+    // O(1) when indexed, via the tracked predecessor; otherwise the
+    // predecessor is found by walking from the head
+    void remove(Handle node) {
+        Node* prev = nullptr;
+        if (indexed) {
+            prev = index.pred(node);
+        } else if (node != head) {
+            prev = head;
+            while (prev->next != node) prev = prev->next;
+        }
+        unlinkAfter(prev);
+    }
+
+    // Moves all nodes into one contiguous run in traversal order and frees
+    // the old memory. Invalidates handles.
+    void compact() {
+        size_t n = 0;
+        for (Node* current = head; current; current = current->next) n++;
+        if (n == 0) return;
+        NodeArena<Node> fresh;
+        Node* run = fresh.allocateRun(n);
+        Node* current = head;
+        for (size_t i = 0; i < n; ++i, current = current->next) {
+            new (&run[i]) Node(current->data);
+            if (i) run[i - 1].next = &run[i];
+        }
+        head = run;
+        tail = &run[n - 1];
+        arena.adopt(fresh);
+        if (indexed) {
+            index.clear();
+            Node* prev = nullptr;
+            for (Node* node = head; node; prev = node, node = node->next) index.append(node, prev);
         }
     }
 
@@ -54,6 +286,7 @@ public:
         vector<int> result;
         Node* current = head;
         while (current) {
+            if (current->next) __builtin_prefetch(current->next->next);
             result.push_back(current->data);
             current = current->next;
         }
@@ -62,6 +295,10 @@ public:
 };
 
 // Doubly Linked List
+// Tail pointer for O(1) insert; the optional ValueIndex chains each value's
+// nodes in list order, so remove(data) and remove(handle) are O(1) expected.
+// Handles returned by insert stay valid until that node is removed or the
+// list is compacted.
 class DoublyLinkedList {
     struct Node {
         int data;
@@ -71,46 +308,94 @@ class DoublyLinkedList {
     };
 
     Node* head;
+    Node* tail;
+    bool indexed;
+    ValueIndex<Node> index;
+    NodeArena<Node> arena;
+
+    void unlink(Node* current) {
+        if (current->prev) {
+            current->prev->next = current->next;
+        }
+        if (current->next) {
+            current->next->prev = current->prev;
+        }
+        if (current == head) {
+            head = current->next;
+        }
+        if (current == tail) {
+            tail = current->prev;
+        }
+        if (indexed) index.erase(current);
+        arena.destroy(current);
+    }
 
 public:
-    DoublyLinkedList() : head(nullptr) {}
+    using Handle = Node*;
 
-    void insert(int data) {
-        Node* new_node = new Node(data);
+    DoublyLinkedList(bool indexed = false) : head(nullptr), tail(nullptr), indexed(indexed) {}
+
+    Handle insert(int data) {
+        Node* new_node = arena.create(data);
+        if (indexed) index.append(new_node);
         if (!head) {
             head = new_node;
         } else {
-            Node* current = head;
-            while (current->next) {
-                current = current->next;
-            }
-            current->next = new_node;
-            new_node->prev = current;
+            tail->next = new_node;
+            new_node->prev = tail;
         }
+        tail = new_node;
+        return new_node;
     }
 
     void remove(int data) {
-        Node* current = head;
-        while (current && current->data != data) {
-            current = current->next;
+        Node* current = nullptr;
+        if (indexed) {
+            current = index.first(data);
+        } else {
+            current = head;
+            while (current && current->data != data) {
+                current = current->next;
+            }
         }
         if (!current) return;
-        if (current->prev) {
-            current->prev->next = current->next;
-        }
-        if (current->next) {
-            current->next->prev = current->prev;
+        unlink(current);
+    }
+
+    void remove(Handle node) {
+        unlink(node);
+    }
+
+    // Moves all nodes into one contiguous run in traversal order and frees
+    // the old memory. Invalidates handles.
+    void compact() {
+        size_t n = 0;
+        for (Node* current = head; current; current = current->next) n++;
+        if (n == 0) return;
+        NodeArena<Node> fresh;
+        Node* run = fresh.allocateRun(n);
+        Node* current = head;
+        for (size_t i = 0; i < n; ++i, current = current->next) {
+            new (&run[i]) Node(current->data);
+            if (i) {
+                run[i - 1].next = &run[i];
+                run[i].prev = &run[i - 1];
+            }
         }
-        if (current == head) {
-            head = current->next;
+        head = run;
+        tail = &run[n - 1];
+        arena.adopt(fresh);
+        if (indexed) {
+            index.clear();
+            for (Node* node = head; node; node = node->next) index.append(node);
         }
-        delete current;
     }
 
     vector<int> traverse() {
         vector<int> result;
         Node* current = head;
         while (current) {
+            if (current->next) __builtin_prefetch(current->next->next);
             result.push_back(current->data);
             current = current->next;
         }
@@ -119,6 +404,9 @@ public:
 };
 
 // Circular Linked List
+// Keeps the tail (whose next is the head) so insert is O(1), plus a cursor
+// for round-robin use. The cursor is stored as the node before it, so
+// insert-before/after-cursor, removeCurrent and advance are all O(1).
 class CircularLinkedList {
     struct Node {
         int data;
@@ -126,41 +414,765 @@ class CircularLinkedList {
         Node(int val) : data(val), next(nullptr) {}
     };
 
-    Node* head;
+    Node* tail;
+    Node* beforeCursor;
+    size_t count;
+    NodeArena<Node> arena;
+
+    Node* createFirst(int data) {
+        Node* new_node = arena.create(data);
+        new_node->next = new_node;
+        tail = beforeCursor = new_node;
+        count = 1;
+        return new_node;
+    }
 
 public:
-    CircularLinkedList() : head(nullptr) {}
+    CircularLinkedList() : tail(nullptr), beforeCursor(nullptr), count(0) {}
 
     void insert(int data) {
-        Node* new_node = new Node(data);
-        if (!head) {
-            head = new_node;
-            head->next = head;
+        if (!tail) {
+            createFirst(data);
+            return;
+        }
+        Node* new_node = arena.create(data);
+        new_node->next = tail->next;
+        tail->next = new_node;
+        if (beforeCursor == tail) beforeCursor = new_node; // cursor stays put
+        tail = new_node;
+        count++;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    int current() const {
+        return beforeCursor->next->data;
+    }
+
+    void advance() {
+        if (beforeCursor) beforeCursor = beforeCursor->next;
+    }
+
+    // Joins the ring just after the cursor (visited next after current)
+    void insertAfterCursor(int data) {
+        if (!tail) {
+            createFirst(data);
+            return;
+        }
+        Node* cursor = beforeCursor->next;
+        Node* new_node = arena.create(data);
+        new_node->next = cursor->next;
+        cursor->next = new_node;
+        if (cursor == tail) tail = new_node;
+        if (cursor == beforeCursor) beforeCursor = new_node; // single node: keep cursor on it
+        count++;
+    }
+
+    // Joins the ring just before the cursor (visited last in this round)
+    void insertBeforeCursor(int data) {
+        if (!tail) {
+            createFirst(data);
+            return;
+        }
+        Node* new_node = arena.create(data);
+        new_node->next = beforeCursor->next;
+        beforeCursor->next = new_node;
+        if (beforeCursor == tail) tail = new_node;
+        beforeCursor = new_node;
+        count++;
+    }
+
+    // Removes the node under the cursor; the cursor moves to its successor
+    int removeCurrent() {
+        Node* cursor = beforeCursor->next;
+        int data = cursor->data;
+        if (cursor == beforeCursor) {
+            tail = beforeCursor = nullptr;
         } else {
-            Node* current = head;
-            while (current->next != head) {
-                current = current->next;
-            }
-            current->next = new_node;
-            new_node->next = head;
+            beforeCursor->next = cursor->next;
+            if (cursor == tail) tail = beforeCursor;
         }
+        arena.destroy(cursor);
+        count--;
+        return data;
     }
 
     vector<int> traverse() {
         vector<int> result;
-        if (!head) return result;
+        if (!tail) return result;
+        Node* head = tail->next;
         Node* current = head;
         do {
+            __builtin_prefetch(current->next->next);
             result.push_back(current->data);
             current = current->next;
         } while (current != head);
         return result;
     }
+
+    // Moves all nodes into one contiguous run in traversal order
+    void compact() {
+        if (!tail) return;
+        NodeArena<Node> fresh;
+        Node* run = fresh.allocateRun(count);
+        Node* current = tail->next;
+        size_t cursorIndex = 0;
+        for (size_t i = 0; i < count; ++i, current = current->next) {
+            if (current == beforeCursor) cursorIndex = i;
+            new (&run[i]) Node(current->data);
+            run[i].next = &run[(i + 1) % count];
+        }
+        tail = &run[count - 1];
+        beforeCursor = &run[cursorIndex];
+        arena.adopt(fresh);
+    }
+};
+
+// Deficit Round-Robin Scheduler
+// Tenants with queued work sit in a CircularLinkedList ring. Each visit
+// adds quantum * weight credit to the tenant's deficit and dispatches
+// queued tasks while their cost fits; idle tenants leave the ring and
+// rejoin at the back of the round when new work arrives. Each step is
+// O(1) plus O(1) per dispatched task.
+class RoundRobinScheduler {
+public:
+    struct Tenant {
+        int weight = 1;
+        long long deficit = 0;
+        deque<int> tasks; // task costs
+        bool inRing = false;
+    };
+
+private:
+    CircularLinkedList ring;
+    unordered_map<int, Tenant> tenants;
+    int quantum;
+    size_t pending;
+
+public:
+    RoundRobinScheduler(int quantum = 1) : quantum(quantum), pending(0) {}
+
+    void setWeight(int tenant, int weight) {
+        tenants[tenant].weight = max(1, weight);
+    }
+
+    void submit(int tenant, int cost) {
+        Tenant& t = tenants[tenant];
+        t.tasks.push_back(cost);
+        pending++;
+        if (!t.inRing) {
+            t.inRing = true;
+            ring.insertBeforeCursor(tenant);
+        }
+    }
+
+    size_t pendingTasks() const {
+        return pending;
+    }
+
+    bool isIdle() const {
+        return ring.isEmpty();
+    }
+
+    // Tenant under the cursor; the scheduler must not be idle
+    int currentTenant() const {
+        return ring.current();
+    }
+
+    // Serves the tenant under the cursor; false if there is no work
+    template <typename Dispatch>
+    bool step(Dispatch dispatch) {
+        if (ring.isEmpty()) return false;
+        int id = ring.current();
+        Tenant& t = tenants[id];
+        t.deficit += (long long)quantum * t.weight;
+        while (!t.tasks.empty() && t.tasks.front() <= t.deficit) {
+            int cost = t.tasks.front();
+            t.tasks.pop_front();
+            t.deficit -= cost;
+            pending--;
+            dispatch(id, cost);
+        }
+        if (t.tasks.empty()) {
+            t.deficit = 0;
+            t.inRing = false;
+            ring.removeCurrent();
+        } else {
+            ring.advance();
+        }
+        return true;
+    }
+
+    // Hands the tenant under the cursor (and its queue) to the caller.
+    // A scheduler's last tenant is never given away, so an idle pool
+    // cannot bounce one tenant between thieves without serving it.
+    bool stealTenant(int& id, Tenant& state) {
+        if (ring.size() < 2) return false;
+        id = ring.removeCurrent();
+        auto it = tenants.find(id);
+        state = move(it->second);
+        tenants.erase(it);
+        pending -= state.tasks.size();
+        return true;
+    }
+
+    void adoptTenant(int id, Tenant state) {
+        pending += state.tasks.size();
+        state.inRing = !state.tasks.empty();
+        Tenant& t = tenants[id] = move(state);
+        if (t.inRing) ring.insertBeforeCursor(id);
+    }
+};
+
+// Multi-threaded round robin: one scheduler ring per worker, tenants
+// placed by id. A worker whose ring runs dry steals the current tenant
+// (with its whole queue) from another worker, so a tenant is only ever
+// served by one worker at a time and keeps its DRR state. Tasks are
+// dispatched with no lock held, so dispatch may submit follow-up work;
+// the tenant being dispatched is marked busy and cannot be stolen.
+// Stolen tenants are recorded in `owners`, which only changes while the
+// old owner's lock is held: submit and setWeight look the owner up, lock
+// it, and retry if the tenant moved in between. Steals take `ownersLock`
+// exclusively only after they succeed.
+class ParallelRoundRobin {
+private:
+    struct alignas(CACHE_LINE) Worker {
+        mutex lock;
+        RoundRobinScheduler scheduler;
+        bool busy = false; // busyTenant is being dispatched
+        int busyTenant = 0;
+        Worker(int quantum) : scheduler(quantum) {}
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    atomic<size_t> remaining;
+    shared_mutex ownersLock;
+    unordered_map<int, size_t> owners; // tenant -> worker, once moved from tenant % workers
+
+    size_t ownerOf(int tenant) {
+        shared_lock<shared_mutex> route(ownersLock);
+        auto it = owners.find(tenant);
+        return it == owners.end() ? (size_t)tenant % workers.size() : it->second;
+    }
+
+    // Runs fn on the scheduler that owns tenant, under that worker's lock
+    template <typename Fn>
+    void withOwner(int tenant, Fn fn) {
+        for (size_t w = ownerOf(tenant);;) {
+            lock_guard<mutex> guard(workers[w]->lock);
+            size_t now = ownerOf(tenant);
+            if (now == w) {
+                fn(workers[w]->scheduler);
+                return;
+            }
+            w = now;
+        }
+    }
+
+    // Moves victim's current tenant to worker i; false if none was taken
+    bool steal(size_t i, Worker& victim) {
+        Worker& self = *workers[i];
+        int id;
+        RoundRobinScheduler::Tenant state;
+        scoped_lock guard(victim.lock, self.lock);
+        if (victim.scheduler.isIdle()) return false;
+        if (victim.busy && victim.scheduler.currentTenant() == victim.busyTenant) return false;
+        if (!victim.scheduler.stealTenant(id, state)) return false;
+        self.scheduler.adoptTenant(id, move(state));
+        unique_lock<shared_mutex> route(ownersLock);
+        owners[id] = i;
+        return true;
+    }
+
+public:
+    ParallelRoundRobin(unsigned threads, int quantum) : remaining(0) {
+        for (unsigned i = 0; i < max(1u, threads); ++i) workers.emplace_back(new Worker(quantum));
+    }
+
+    void setWeight(int tenant, int weight) {
+        withOwner(tenant, [&](RoundRobinScheduler& s) { s.setWeight(tenant, weight); });
+    }
+
+    void submit(int tenant, int cost) {
+        withOwner(tenant, [&](RoundRobinScheduler& s) {
+            s.submit(tenant, cost);
+            remaining++;
+        });
+    }
+
+    // Runs until every submitted task, including ones submitted by
+    // dispatch itself, has been dispatched
+    template <typename Dispatch>
+    void run(Dispatch dispatch) {
+        vector<thread> threads;
+        for (size_t i = 0; i < workers.size(); ++i) {
+            threads.emplace_back([this, i, &dispatch] {
+                Worker& self = *workers[i];
+                vector<int> batch;
+                while (remaining.load() > 0) {
+                    int tenant = 0;
+                    bool served;
+                    {
+                        lock_guard<mutex> guard(self.lock);
+                        served = self.scheduler.step([&](int id, int cost) {
+                            tenant = id;
+                            batch.push_back(cost);
+                        });
+                        self.busy = !batch.empty();
+                        self.busyTenant = tenant;
+                    }
+                    if (!batch.empty()) {
+                        for (int cost : batch) {
+                            dispatch(tenant, cost);
+                            remaining--;
+                        }
+                        batch.clear();
+                        lock_guard<mutex> guard(self.lock);
+                        self.busy = false;
+                    }
+                    if (served) continue;
+                    for (size_t k = 1; k < workers.size(); ++k) {
+                        if (steal(i, *workers[(i + k) % workers.size()])) break;
+                    }
+                    this_thread::yield();
+                }
+            });
+        }
+        for (thread& t : threads) t.join();
+    }
+};
+
+// Bounded LRU/LFU Cache
+// Entries live in a fixed array and are chained into an intrusive doubly
+// linked list by index, ordered from most valuable (head) to the eviction
+// victim (tail). The list is split into frequency groups, highest first;
+// a hit bumps the entry's saturating frequency and moves it to the front
+// of its group. LRU is the single-group case (MAX_FREQUENCY 1), LFU uses
+// 15 groups, so every operation touches at most 15 group heads: O(1).
+// Keys are found through an open-addressing (linear probing) table of
+// entry indices with backward-shift deletion, so there are no tombstones.
+// Key hashes are mixed multiplicatively and the top bits pick the home
+// slot, so sequential integer keys (identity std::hash) still scatter
+// instead of forming one long probe run.
+template <typename Key, typename Value>
+class BoundedCache {
+public:
+    enum Policy { LRU, LFU };
+
+    struct Stats {
+        uint64_t hits, misses, evictions;
+    };
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr int LFU_MAX_FREQUENCY = 15;
+
+    struct Entry {
+        Key key;
+        Value value;
+        uint64_t hash; // mixed
+        uint32_t prev, next;
+        int frequency;
+    };
+
+    vector<Entry> entries;
+    size_t used;
+    uint32_t head, tail;
+    int maxFrequency;
+    uint32_t groupFirst[LFU_MAX_FREQUENCY + 1]; // head-most entry per frequency
+
+    vector<uint32_t> table; // entry index or NIL
+    size_t mask;
+    int shift; // 64 - log2(table size)
+    Stats stats;
+
+    static uint64_t mix(const Key& key) {
+        return (uint64_t)std::hash<Key>()(key) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    size_t homeSlot(uint64_t hash) const {
+        return (size_t)(hash >> shift);
+    }
+
+    size_t findSlot(const Key& key, uint64_t hash) const {
+        for (size_t i = homeSlot(hash);; i = (i + 1) & mask) {
+            uint32_t e = table[i];
+            if (e == NIL || (entries[e].hash == hash && entries[e].key == key)) return i;
+        }
+    }
+
+    void eraseSlot(size_t i) {
+        for (size_t j = (i + 1) & mask; table[j] != NIL; j = (j + 1) & mask) {
+            size_t home = homeSlot(entries[table[j]].hash);
+            // table[j] may move into the hole at i only if i lies on its probe path
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                table[i] = table[j];
+                i = j;
+            }
+        }
+        table[i] = NIL;
+    }
+
+    void unlink(uint32_t e) {
+        Entry& entry = entries[e];
+        if (groupFirst[entry.frequency] == e) {
+            uint32_t next = entry.next;
+            groupFirst[entry.frequency] = next != NIL && entries[next].frequency == entry.frequency ? next : NIL;
+        }
+        if (entry.prev != NIL) entries[entry.prev].next = entry.next; else head = entry.next;
+        if (entry.next != NIL) entries[entry.next].prev = entry.prev; else tail = entry.prev;
+    }
+
+    // Links e at the front of its frequency group
+    void linkFront(uint32_t e) {
+        Entry& entry = entries[e];
+        uint32_t before = NIL; // first entry of the highest non-empty group <= frequency
+        for (int f = entry.frequency; f >= 1 && before == NIL; --f) before = groupFirst[f];
+        entry.next = before;
+        entry.prev = before != NIL ? entries[before].prev : tail;
+        if (entry.prev != NIL) entries[entry.prev].next = e; else head = e;
+        if (before != NIL) entries[before].prev = e; else tail = e;
+        groupFirst[entry.frequency] = e;
+    }
+
+    void touch(uint32_t e) {
+        unlink(e);
+        entries[e].frequency = min(entries[e].frequency + 1, maxFrequency);
+        linkFront(e);
+    }
+
+public:
+    BoundedCache(size_t capacity, Policy policy = LRU)
+        : entries(max<size_t>(capacity, 1)), used(0), head(NIL), tail(NIL),
+          maxFrequency(policy == LFU ? LFU_MAX_FREQUENCY : 1), stats{0, 0, 0} {
+        fill(begin(groupFirst), end(groupFirst), NIL);
+        size_t slots = 2;
+        shift = 63;
+        while (slots < 2 * entries.size()) {
+            slots <<= 1;
+            shift--;
+        }
+        table.assign(slots, NIL);
+        mask = slots - 1;
+    }
+
+    bool get(const Key& key, Value& value) {
+        uint64_t hash = mix(key);
+        uint32_t e = table[findSlot(key, hash)];
+        if (e == NIL) {
+            stats.misses++;
+            return false;
+        }
+        stats.hits++;
+        touch(e);
+        value = entries[e].value;
+        return true;
+    }
+
+    void put(const Key& key, const Value& value) {
+        uint64_t hash = mix(key);
+        size_t slot = findSlot(key, hash);
+        if (table[slot] != NIL) {
+            entries[table[slot]].value = value;
+            touch(table[slot]);
+            return;
+        }
+        uint32_t e;
+        if (used < entries.size()) {
+            e = used++;
+        } else {
+            e = tail;
+            unlink(e);
+            eraseSlot(findSlot(entries[e].key, entries[e].hash));
+            stats.evictions++;
+            slot = findSlot(key, hash); // the table may have shifted
+        }
+        entries[e].key = key;
+        entries[e].value = value;
+        entries[e].hash = hash;
+        entries[e].frequency = 1;
+        linkFront(e);
+        table[slot] = e;
+    }
+
+    size_t size() const {
+        return used;
+    }
+
+    Stats getStats() const {
+        return stats;
+    }
+};
+
+// Sharded cache for concurrent use: keys are spread over independently
+// locked BoundedCache shards, so threads only contend on the same shard.
+template <typename Key, typename Value>
+class ShardedCache {
+private:
+    struct alignas(CACHE_LINE) Shard {
+        mutex lock;
+        unique_ptr<BoundedCache<Key, Value>> cache;
+    };
+
+    vector<Shard> shards;
+
+    Shard& shardFor(const Key& key) {
+        // a different multiplier from BoundedCache::mix, so the shard choice
+        // stays independent of the slot the shard's table picks
+        uint64_t hash = (uint64_t)std::hash<Key>()(key) * 0xC2B2AE3D27D4EB4FULL;
+        return shards[(hash >> 32) % shards.size()];
+    }
+
+public:
+    using Policy = typename BoundedCache<Key, Value>::Policy;
+
+    ShardedCache(size_t capacity, size_t shardCount, Policy policy)
+        : shards(max<size_t>(shardCount, 1)) {
+        for (Shard& shard : shards) {
+            shard.cache.reset(new BoundedCache<Key, Value>((capacity + shards.size() - 1) / shards.size(), policy));
+        }
+    }
+
+    bool get(const Key& key, Value& value) {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+        return shard.cache->get(key, value);
+    }
+
+    void put(const Key& key, const Value& value) {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+        shard.cache->put(key, value);
+    }
+
+    typename BoundedCache<Key, Value>::Stats getStats() {
+        typename BoundedCache<Key, Value>::Stats total{0, 0, 0};
+        for (Shard& shard : shards) {
+            lock_guard<mutex> guard(shard.lock);
+            auto s = shard.cache->getStats();
+            total.hits += s.hits;
+            total.misses += s.misses;
+            total.evictions += s.evictions;
+        }
+        return total;
+    }
 };
 
 // Postfix Calculator
 class PostfixCalculator {
 public:
+    enum Op : uint8_t { PUSH, LOAD, ADD, SUB, MUL, DIV, ADD_K, SUB_K, MUL_K, DIV_K, ADD_V, SUB_V, MUL_V, DIV_V };
+
+    struct Instruction {
+        Op op;
+        int operand;
+    };
+
+    // Integer semantics shared by the bytecode: + - * wrap modulo 2^32,
+    // x / 0 is 0 and INT_MIN / -1 is INT_MIN
+    static int add(int a, int b) { return (int)((uint32_t)a + (uint32_t)b); }
+    static int sub(int a, int b) { return (int)((uint32_t)a - (uint32_t)b); }
+    static int mul(int a, int b) { return (int)((uint32_t)a * (uint32_t)b); }
+    static int div(int a, int b) {
+        int64_t q = (int64_t)a / (b | (b == 0));
+        return (int)((uint32_t)q & -(uint32_t)(b != 0));
+    }
+
+    // dst[i] = a[i] op b[i] for op in ADD..DIV, with the same semantics as
+    // above and no per-element branch. AVX2 has no integer divide, so / goes
+    // through double (exact for 32-bit operands); zero divisors are replaced
+    // by 1 and their lanes masked to 0, and INT_MIN / -1 converts to INT_MIN.
+    static void applyColumns(Op op, int* dst, const int* a, const int* b, size_t n) {
+        size_t i = 0;
+#ifdef __AVX2__
+        const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi32(1);
+        for (; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+            __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+            __m256i r;
+            if (op == ADD) {
+                r = _mm256_add_epi32(x, y);
+            } else if (op == SUB) {
+                r = _mm256_sub_epi32(x, y);
+            } else if (op == MUL) {
+                r = _mm256_mullo_epi32(x, y);
+            } else {
+                __m256i byZero = _mm256_cmpeq_epi32(y, zero);
+                y = _mm256_or_si256(y, _mm256_and_si256(byZero, one));
+                __m128i lo = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)),
+                                                               _mm256_cvtepi32_pd(_mm256_castsi256_si128(y))));
+                __m128i hi = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)),
+                                                               _mm256_cvtepi32_pd(_mm256_extracti128_si256(y, 1))));
+                r = _mm256_andnot_si256(byZero, _mm256_set_m128i(hi, lo));
+            }
+            _mm256_storeu_si256((__m256i*)(dst + i), r);
+        }
+#endif
+        switch (op) {
+            case ADD: for (; i < n; ++i) dst[i] = add(a[i], b[i]); break;
+            case SUB: for (; i < n; ++i) dst[i] = sub(a[i], b[i]); break;
+            case MUL: for (; i < n; ++i) dst[i] = mul(a[i], b[i]); break;
+            default: for (; i < n; ++i) dst[i] = div(a[i], b[i]); break;
+        }
+    }
+
+    // Compiled Expression: flat bytecode with variable slots, evaluated on a fixed stack
+    class Compiled {
+    public:
+        bool valid() const { return ok; }
+        size_t length() const { return code.size(); }
+        int variableCount() const { return (int)names.size(); }
+        const vector<string>& variables() const { return names; }
+
+        int slot(const string& name) const {
+            for (size_t i = 0; i < names.size(); ++i) {
+                if (names[i] == name) return (int)i;
+            }
+            return -1;
+        }
+
+        int eval(const vector<int>& vars) const {
+            if (vars.size() < names.size()) {
+                cout << "Expected " << names.size() << " variables, got " << vars.size() << endl;
+                return 0;
+            }
+            return eval(vars.data());
+        }
+
+        // vars[i] is the value of variables()[i]; no allocation once the
+        // stack fits in STACK_SLOTS
+        int eval(const int* vars) const {
+            if (!ok) return 0;
+            int local[STACK_SLOTS];
+            int* stack = local;
+            if (maxDepth > STACK_SLOTS) {
+                thread_local vector<int> spill;
+                if ((int)spill.size() < maxDepth) spill.resize(maxDepth);
+                stack = spill.data();
+            }
+            int* sp = stack - 1;
+            for (const Instruction& in : code) {
+                switch (in.op) {
+                    case PUSH: *++sp = in.operand; break;
+                    case LOAD: *++sp = vars[in.operand]; break;
+                    case ADD: sp[-1] = add(sp[-1], sp[0]); --sp; break;
+                    case SUB: sp[-1] = sub(sp[-1], sp[0]); --sp; break;
+                    case MUL: sp[-1] = mul(sp[-1], sp[0]); --sp; break;
+                    case DIV: sp[-1] = div(sp[-1], sp[0]); --sp; break;
+                    case ADD_K: *sp = add(*sp, in.operand); break;
+                    case SUB_K: *sp = sub(*sp, in.operand); break;
+                    case MUL_K: *sp = mul(*sp, in.operand); break;
+                    case DIV_K: *sp = div(*sp, in.operand); break;
+                    case ADD_V: *sp = add(*sp, vars[in.operand]); break;
+                    case SUB_V: *sp = sub(*sp, vars[in.operand]); break;
+                    case MUL_V: *sp = mul(*sp, vars[in.operand]); break;
+                    case DIV_V: *sp = div(*sp, vars[in.operand]); break;
+                }
+            }
+            return *sp;
+        }
+
+        // Batch mode: out[r] = eval of row r, where columns[i] holds
+        // variables()[i] for every row. Runs one instruction at a time over
+        // tiles of TILE_ROWS rows; batches of at least 2 * BATCH_MIN_ROWS
+        // are split across threads.
+        void evalBatch(const vector<const int*>& columns, size_t rows, int* out, unsigned threads = 0) const {
+            if (columns.size() < names.size()) {
+                cout << "Expected " << names.size() << " columns, got " << columns.size() << endl;
+                return;
+            }
+            if (!ok) {
+                fill(out, out + rows, 0);
+                return;
+            }
+            if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+            size_t perThread = max(BATCH_MIN_ROWS, (rows + threads - 1) / threads);
+            perThread = (perThread + TILE_ROWS - 1) / TILE_ROWS * TILE_ROWS;
+            if (perThread >= rows) {
+                evalRange(columns, 0, rows, out);
+                return;
+            }
+            vector<thread> workers;
+            for (size_t begin = 0; begin < rows; begin += perThread) {
+                workers.emplace_back([&, begin] { evalRange(columns, begin, min(rows, begin + perThread), out); });
+            }
+            for (thread& worker : workers) worker.join();
+        }
+
+        vector<int> evalBatch(const vector<vector<int>>& columns, unsigned threads = 0) const {
+            size_t rows = columns.empty() ? 0 : columns[0].size();
+            vector<const int*> pointers;
+            for (const vector<int>& column : columns) {
+                rows = min(rows, column.size());
+                pointers.push_back(column.data());
+            }
+            vector<int> out(rows);
+            evalBatch(pointers, rows, out.data(), threads);
+            return out;
+        }
+
+    private:
+        friend class PostfixCalculator;
+        static constexpr int STACK_SLOTS = 64;
+        static constexpr size_t TILE_ROWS = 1024;
+        static constexpr size_t BATCH_MIN_ROWS = 1 << 16;
+
+        // Stack entries are pointers to tile-sized runs: constants point at
+        // a pre-filled tile, variables straight into their column, and
+        // intermediate results into one scratch tile per stack depth.
+        void evalRange(const vector<const int*>& columns, size_t begin, size_t end, int* out) const {
+            vector<int> scratch(maxDepth * TILE_ROWS);
+            vector<int> constants;
+            vector<const int*> stack(maxDepth);
+            for (const Instruction& in : code) {
+                if (in.op == PUSH || (in.op >= ADD_K && in.op <= DIV_K)) {
+                    constants.insert(constants.end(), TILE_ROWS, in.operand);
+                }
+            }
+            for (size_t base = begin; base < end; base += TILE_ROWS) {
+                size_t n = min(TILE_ROWS, end - base);
+                int depth = 0;
+                const int* constant = constants.data();
+                for (const Instruction& in : code) {
+                    const int* right = nullptr;
+                    Op op = in.op;
+                    if (op == PUSH) {
+                        stack[depth++] = constant;
+                        constant += TILE_ROWS;
+                        continue;
+                    } else if (op == LOAD) {
+                        stack[depth++] = columns[in.operand] + base;
+                        continue;
+                    } else if (op >= ADD_K && op <= DIV_K) {
+                        right = constant;
+                        constant += TILE_ROWS;
+                        op = (Op)(op - ADD_K + ADD);
+                    } else if (op >= ADD_V) {
+                        right = columns[in.operand] + base;
+                        op = (Op)(op - ADD_V + ADD);
+                    } else {
+                        right = stack[--depth];
+                    }
+                    int* dst = scratch.data() + (depth - 1) * TILE_ROWS;
+                    applyColumns(op, dst, stack[depth - 1], right, n);
+                    stack[depth - 1] = dst;
+                }
+                memcpy(out + base, stack[0], n * sizeof(int));
+            }
+        }
+
+        vector<Instruction> code;
+        vector<string> names;
+        int maxDepth = 0;
+        bool ok = false;
+    };
+
     int evaluate(const string& expression) {
         vector<int> stack;
         stringstream ss(expression);
@@ -180,24 +1192,312 @@ public:
         }
         return stack.back();
     }
+
+    // Parses once into bytecode. Identifiers become variable slots: the
+    // given names first, then new ones in order of appearance. An operator
+    // whose right operand is a constant or variable is fused with it, and
+    // operators on two constants are folded at compile time.
+    Compiled compile(const string& expression, const vector<string>& variables = {}) {
+        Compiled result;
+        result.names = variables;
+        stringstream ss(expression);
+        string token;
+        int depth = 0;
+
+        while (ss >> token) {
+            if (isdigit((unsigned char)token[0])) {
+                long long value = 0;
+                for (char c : token) {
+                    if (!isdigit((unsigned char)c) || value > INT32_MAX) {
+                        cout << "Invalid number: " << token << endl;
+                        return Compiled();
+                    }
+                    value = value * 10 + (c - '0');
+                }
+                if (value > INT32_MAX) {
+                    cout << "Invalid number: " << token << endl;
+                    return Compiled();
+                }
+                result.code.push_back({PUSH, (int)value});
+                result.maxDepth = max(result.maxDepth, ++depth);
+            } else if (isalpha((unsigned char)token[0]) || token[0] == '_') {
+                for (char c : token) {
+                    if (!isalnum((unsigned char)c) && c != '_') {
+                        cout << "Invalid variable: " << token << endl;
+                        return Compiled();
+                    }
+                }
+                int slot = result.slot(token);
+                if (slot < 0) {
+                    slot = (int)result.names.size();
+                    result.names.push_back(token);
+                }
+                result.code.push_back({LOAD, slot});
+                result.maxDepth = max(result.maxDepth, ++depth);
+            } else if (token.size() == 1 && string("+-*/").find(token[0]) != string::npos) {
+                if (depth < 2) {
+                    cout << "Not enough operands for " << token << endl;
+                    return Compiled();
+                }
+                --depth;
+                emitOperator(result.code, (Op)(ADD + string("+-*/").find(token[0])));
+            } else {
+                cout << "Invalid token: " << token << endl;
+                return Compiled();
+            }
+        }
+        if (depth != 1) {
+            cout << "Expression leaves " << depth << " values on the stack" << endl;
+            return Compiled();
+        }
+        result.ok = true;
+        return result;
+    }
+
+private:
+    static void emitOperator(vector<Instruction>& code, Op op) {
+        Instruction& right = code.back();
+        if (right.op == PUSH) {
+            right.op = (Op)(op - ADD + ADD_K);
+        } else if (right.op == LOAD) {
+            right.op = (Op)(op - ADD + ADD_V);
+        } else {
+            code.push_back({op, 0});
+            return;
+        }
+        if (code.size() >= 2 && code[code.size() - 2].op == PUSH && right.op >= ADD_K && right.op <= DIV_K) {
+            Instruction& left = code[code.size() - 2];
+            int b = right.operand;
+            switch (right.op) {
+                case ADD_K: left.operand = add(left.operand, b); break;
+                case SUB_K: left.operand = sub(left.operand, b); break;
+                case MUL_K: left.operand = mul(left.operand, b); break;
+                default: left.operand = div(left.operand, b); break;
+            }
+            code.pop_back();
+        }
+    }
+};
+
+// Cyclic get/put over twice the capacity, so every miss evicts. Keys are
+// sequential or strided ints; unmixed hashes would pile these into long
+// probe runs and take seconds instead of milliseconds.
+void benchmarkCache() {
+    const int capacity = 50000, ops = 200000;
+    for (int stride : {1, 7, 4096}) {
+        BoundedCache<int, int> cache(capacity);
+        auto start = chrono::steady_clock::now();
+        int value;
+        for (int i = 0; i < ops; ++i) {
+            int key = i % (2 * capacity) * stride;
+            if (!cache.get(key, value)) cache.put(key, i);
+        }
+        long long us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        cout << "cache stride " << stride << ": " << ops << " get/put in " << us << " us, "
+             << cache.getStats().evictions << " evictions" << (us > 1000000 ? " TOO SLOW" : "") << endl;
+    }
+}
+
+void benchmarkPostfix() {
+    const int n = 1000000;
+    auto us = [](chrono::steady_clock::time_point since) {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - since).count();
+    };
+    PostfixCalculator calc;
+
+    // The string path has no variables, so feed it the same numbers as text
+    const string pattern = "a b + c * d - a /";
+    vector<string> texts;
+    vector<vector<int>> inputs;
+    for (int i = 0; i < 64; ++i) {
+        inputs.push_back({i + 1, i * 3, i % 7 + 2, i * i});
+        const vector<int>& v = inputs.back();
+        texts.push_back(to_string(v[0]) + " " + to_string(v[1]) + " + " + to_string(v[2]) + " * " +
+                        to_string(v[3]) + " - " + to_string(v[0]) + " /");
+    }
+
+    auto start = chrono::steady_clock::now();
+    long long stringSum = 0;
+    for (int i = 0; i < n; ++i) stringSum += calc.evaluate(texts[i & 63]);
+    long long stringTime = us(start);
+
+    start = chrono::steady_clock::now();
+    PostfixCalculator::Compiled compiled = calc.compile(pattern, {"a", "b", "c", "d"});
+    long long bytecodeSum = 0;
+    for (int i = 0; i < n; ++i) bytecodeSum += compiled.eval(inputs[i & 63].data());
+    long long bytecodeTime = us(start);
+
+    cout << "postfix x" << n << " \"" << pattern << "\": evaluate " << stringTime << " us, compile+eval "
+         << bytecodeTime << " us (" << compiled.length() << " instructions)"
+         << (stringSum == bytecodeSum ? "" : " MISMATCH") << endl;
+
+    const size_t rows = 4000000;
+    vector<vector<int>> columns(4, vector<int>(rows));
+    for (size_t r = 0; r < rows; ++r) {
+        for (int c = 0; c < 4; ++c) columns[c][r] = (int)((r * 2654435761u + c * 40503u) % 2001) - 1000;
+    }
+    start = chrono::steady_clock::now();
+    vector<int> perRow(rows);
+    int vars[4];
+    for (size_t r = 0; r < rows; ++r) {
+        for (int c = 0; c < 4; ++c) vars[c] = columns[c][r];
+        perRow[r] = compiled.eval(vars);
+    }
+    long long rowTime = us(start);
+    start = chrono::steady_clock::now();
+    vector<int> batched = compiled.evalBatch(columns, 1);
+    long long batchTime = us(start);
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    start = chrono::steady_clock::now();
+    vector<int> parallel = compiled.evalBatch(columns, threads);
+    long long parallelTime = us(start);
+    cout << "postfix batch x" << rows << ": per-row eval " << rowTime << " us, columns " << batchTime << " us, "
+         << threads << " threads " << parallelTime << " us"
+         << (perRow == batched && perRow == parallel ? "" : " MISMATCH") << endl;
+}
+
+// Unrolled Queue
+// A linked queue whose nodes each hold a cache line's worth of elements
+// (at least 16, so large element types still amortize the link), consumed
+// from head and filled at tail within the block.
+// One pointer per block instead of per element, and dequeues walk memory
+// sequentially. Emptied blocks go on a free list for reuse.
+template <typename T>
+class UnrolledQueue {
+private:
+    static constexpr size_t BLOCK_ITEMS = CACHE_LINE / sizeof(T) > 16 ? CACHE_LINE / sizeof(T) : 16;
+
+    struct Block {
+        alignas(CACHE_LINE) T items[BLOCK_ITEMS];
+        size_t head, tail; // live items are [head, tail)
+        Block* next;
+    };
+
+    Block *front, *rear, *freeBlocks;
+    size_t count;
+
+    Block* newBlock() {
+        Block* block = freeBlocks;
+        if (block) {
+            freeBlocks = block->next;
+        } else {
+            block = new Block;
+        }
+        block->head = block->tail = 0;
+        block->next = nullptr;
+        return block;
+    }
+
+public:
+    UnrolledQueue() : front(nullptr), rear(nullptr), freeBlocks(nullptr), count(0) {}
+
+    UnrolledQueue(const UnrolledQueue&) = delete;
+    UnrolledQueue& operator=(const UnrolledQueue&) = delete;
+
+    ~UnrolledQueue() {
+        Block* lists[] = {front, freeBlocks};
+        for (Block* block : lists) {
+            while (block) {
+                Block* next = block->next;
+                delete block;
+                block = next;
+            }
+        }
+    }
+
+    void enqueue(T value) {
+        if (!rear || rear->tail == BLOCK_ITEMS) {
+            Block* block = newBlock();
+            if (rear) {
+                rear->next = block;
+            } else {
+                front = block;
+            }
+            rear = block;
+        }
+        rear->items[rear->tail++] = move(value);
+        count++;
+    }
+
+    bool dequeue(T& value) {
+        if (count == 0) return false;
+        value = move(front->items[front->head++]);
+        count--;
+        if (front->head == front->tail) {
+            Block* empty = front;
+            front = front->next;
+            if (!front) rear = nullptr;
+            empty->next = freeBlocks;
+            freeBlocks = empty;
+        }
+        return true;
+    }
+
+    T& peek() {
+        return front->items[front->head];
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    // Visits elements front to back without removing them
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (const Block* block = front; block; block = block->next) {
+            for (size_t i = block->head; i < block->tail; ++i) visit(block->items[i]);
+        }
+    }
+
+    // Removes every element, front to back, handing each to sink
+    template <typename Sink>
+    void drain(Sink sink) {
+        while (front) {
+            for (size_t i = front->head; i < front->tail; ++i) sink(move(front->items[i]));
+            Block* empty = front;
+            front = front->next;
+            empty->next = freeBlocks;
+            freeBlocks = empty;
+        }
+        rear = nullptr;
+        count = 0;
+    }
 };
 
 // Ticket Queue
 class TicketQueue {
+public:
+    enum Storage { DEQUE, UNROLLED };
+
+private:
+    Storage storage;
     deque<string> queue;
+    UnrolledQueue<string> blocks; // used in UNROLLED mode
 
 public:
+    TicketQueue(Storage storage = DEQUE) : storage(storage) {}
+
     void enqueue(const string& ticket) {
-        queue.push_back(ticket);
+        if (storage == UNROLLED) {
+            blocks.enqueue(ticket);
+        } else {
+            queue.push_back(ticket);
+        }
     }
 
     string dequeue() {
-        if (!queue.empty()) {
-            string ticket = queue.front();
+        string ticket;
+        if (storage == UNROLLED) {
+            blocks.dequeue(ticket);
+        } else if (!queue.empty()) {
+            ticket = move(queue.front());
             queue.pop_front();
-            return ticket;
         }
-        return "";
+        return ticket;
     }
 };
 
@@ -242,6 +1542,52 @@ int main() {
     }
     cout << endl;
 
+    // Indexed lists with handles
+    SinglyLinkedList isll(true);
+    SinglyLinkedList::Handle four = nullptr;
+    for (int i = 1; i <= 5; ++i) {
+        SinglyLinkedList::Handle node = isll.insert(i);
+        if (i == 4) four = node;
+    }
+    isll.remove(3);
+    isll.remove(1);
+    isll.remove(four);
+    for (int val : isll.traverse()) {
+        cout << val << " ";
+    }
+    cout << endl;
+
+    DoublyLinkedList idll(true);
+    idll.insert(1);
+    DoublyLinkedList::Handle two = idll.insert(2);
+    idll.insert(3);
+    idll.remove(two);
+    idll.remove(3);
+    for (int val : idll.traverse()) {
+        cout << val << " ";
+    }
+    cout << endl;
+
+    // LRU / LFU Cache
+    BoundedCache<int, string> lru(2, BoundedCache<int, string>::LRU);
+    lru.put(1, "one");
+    lru.put(2, "two");
+    string cached;
+    lru.get(1, cached);
+    lru.put(3, "three"); // evicts 2
+    cout << "LRU has 2: " << (lru.get(2, cached) ? "yes" : "no") << ", has 1: " << (lru.get(1, cached) ? cached : "no") << endl;
+    BoundedCache<int, string> lfu(2, BoundedCache<int, string>::LFU);
+    lfu.put(1, "one");
+    lfu.put(2, "two");
+    lfu.get(1, cached);
+    lfu.get(1, cached);
+    lfu.get(2, cached);
+    lfu.put(3, "three"); // evicts 2, which was hit less often than 1
+    BoundedCache<int, string>::Stats stats = lfu.getStats();
+    cout << "LFU has 2: " << (lfu.get(2, cached) ? "yes" : "no") << ", hits " << stats.hits << ", misses "
+         << stats.misses << ", evictions " << stats.evictions << endl;
+    benchmarkCache();
+
     // Circular Linked List
     CircularLinkedList cll;
     cll.insert(1);
@@ -251,9 +1597,45 @@ int main() {
     }
     cout << endl;
 
+    // Churn then compact: nodes end up contiguous in traversal order
+    DoublyLinkedList churned(true);
+    for (int i = 0; i < 100; ++i) churned.insert(i);
+    for (int i = 0; i < 100; i += 2) churned.remove(i);
+    for (int i = 100; i < 110; ++i) churned.insert(i);
+    churned.compact();
+    churned.remove(51);
+    vector<int> kept = churned.traverse();
+    cout << "Compacted list: " << kept.size() << " nodes, first " << kept.front() << ", last " << kept.back() << endl;
+
+    // Round-Robin Scheduler
+    RoundRobinScheduler rr(1);
+    rr.setWeight(1, 2);
+    for (int i = 0; i < 4; ++i) {
+        rr.submit(1, 1);
+        rr.submit(2, 1);
+    }
+    cout << "DRR dispatch order:";
+    while (rr.step([](int tenant, int) { cout << " " << tenant; })) {
+    }
+    cout << endl;
+    ParallelRoundRobin prr(4, 1);
+    atomic<long long> dispatchedCost(0);
+    for (int tenant = 0; tenant < 1000; ++tenant) {
+        for (int job = 0; job < 10; ++job) prr.submit(tenant, 1 + job % 3);
+    }
+    prr.run([&](int, int cost) { dispatchedCost += cost; });
+    cout << "Parallel round robin dispatched cost: " << dispatchedCost.load() << endl;
+
     // Postfix Calculator
     PostfixCalculator calc;
     cout << calc.evaluate("5 1 2 + 4 * + 3 -") << endl;
+    PostfixCalculator::Compiled poly = calc.compile("x x * 3 x * + 7 -");
+    cout << "x^2 + 3x - 7 at x = 4: " << poly.eval({4}) << " (" << poly.length() << " instructions)" << endl;
+    vector<int> polyColumn = poly.evalBatch({{-2, -1, 0, 1, 2}});
+    cout << "x^2 + 3x - 7 at x = -2..2:";
+    for (int value : polyColumn) cout << " " << value;
+    cout << endl;
+    benchmarkPostfix();
 
     // Ticket Queue
     TicketQueue tq;
@@ -261,6 +1643,11 @@ int main() {
     tq.enqueue("ticket2");
     cout << tq.dequeue() << endl;
 
+    TicketQueue utq(TicketQueue::UNROLLED);
+    utq.enqueue("ticket3");
+    utq.enqueue("ticket4");
+    cout << utq.dequeue() << endl;
+
     // Priority Queue
     PriorityQueue pq;
     pq.insert(3);